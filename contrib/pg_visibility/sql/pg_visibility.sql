@@ -164,6 +164,23 @@ commit;
 select * from pg_visibility_map('copyfreeze');
 select * from pg_check_frozen('copyfreeze');
 
+-- Scans mark pages all-visible once all their tuples are hinted visible to
+-- everyone, even in read-only transactions, but not pages holding locked or
+-- deleted tuples.  Temporary tables keep other sessions from holding back
+-- the horizon.  The first scan sets hint bits, the second marks the pages.
+create temp table vis_opt (a int);
+insert into vis_opt select generate_series(1, 600);
+select count(*) from vis_opt;
+select count(*) from vis_opt;
+select * from pg_visibility_map('vis_opt');
+create temp table vis_opt_dml (a int);
+insert into vis_opt_dml select generate_series(1, 600);
+select a from vis_opt_dml where a = 300 for update;
+delete from vis_opt_dml where a = 500;
+select count(*) from vis_opt_dml;
+select count(*) from vis_opt_dml;
+select * from pg_visibility_map('vis_opt_dml');
+
 -- cleanup
 drop table test_partitioned;
 drop view test_view;
@@ -174,3 +191,5 @@ drop foreign data wrapper dummy;
 drop materialized view matview_visibility_test;
 drop table regular_table;
 drop table copyfreeze;
+drop table vis_opt;
+drop table vis_opt_dml;
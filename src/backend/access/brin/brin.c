@@ -574,6 +574,7 @@ bringetbitmap(IndexScanDesc scan, TIDBitmap *tbm)
 	BrinOpaque *opaque;
 	BlockNumber nblocks;
 	BlockNumber heapBlk;
+	BlockNumber runStart = InvalidBlockNumber;
 	int64		totalpages = 0;
 	FmgrInfo   *consistentFn;
 	MemoryContext oldcxt;
@@ -921,24 +922,38 @@ bringetbitmap(IndexScanDesc scan, TIDBitmap *tbm)
 			}
 		}
 
-		/* add the pages in the range to the output bitmap, if needed */
+		/*
+		 * Matching ranges are not added to the output bitmap one page at a
+		 * time.  Instead we remember where the current run of consecutive
+		 * matching ranges started, and add the whole run at once when it
+		 * ends.  On large, well-correlated tables a single run commonly
+		 * spans many ranges, and adding it in bulk lets the bitmap touch
+		 * each lossy chunk only once.
+		 */
 		if (addrange)
 		{
-			BlockNumber pageno;
-
-			for (pageno = heapBlk;
-				 pageno <= Min(nblocks, heapBlk + opaque->bo_pagesPerRange) - 1;
-				 pageno++)
-			{
-				MemoryContextSwitchTo(oldcxt);
-				tbm_add_page(tbm, pageno);
-				totalpages++;
-				MemoryContextSwitchTo(perRangeCxt);
-			}
+			if (runStart == InvalidBlockNumber)
+				runStart = heapBlk;
+		}
+		else if (runStart != InvalidBlockNumber)
+		{
+			MemoryContextSwitchTo(oldcxt);
+			tbm_add_page_range(tbm, runStart, heapBlk - 1);
+			MemoryContextSwitchTo(perRangeCxt);
+			totalpages += heapBlk - runStart;
+			runStart = InvalidBlockNumber;
 		}
 	}
 
 	MemoryContextSwitchTo(oldcxt);
+
+	/* add the final run of matching ranges, if any */
+	if (runStart != InvalidBlockNumber)
+	{
+		tbm_add_page_range(tbm, runStart, nblocks - 1);
+		totalpages += nblocks - runStart;
+	}
+
 	MemoryContextDelete(perRangeCxt);
 
 	if (buf != InvalidBuffer)
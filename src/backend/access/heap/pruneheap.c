@@ -19,6 +19,7 @@
 #include "access/htup_details.h"
 #include "access/multixact.h"
 #include "access/transam.h"
+#include "access/visibilitymap.h"
 #include "access/xlog.h"
 #include "access/xloginsert.h"
 #include "commands/vacuum.h"
@@ -176,6 +177,10 @@ static void heap_prune_record_unchanged_lp_redirect(PruneState *prstate, OffsetN
 
 static void page_verify_redirects(Page page);
 
+static void heap_page_set_all_visible_opt(Relation relation, Buffer buffer);
+static bool heap_page_hinted_all_visible(Page page, GlobalVisState *vistest,
+										 TransactionId *visibility_cutoff_xid);
+
 
 /*
  * Optionally prune and repair fragmentation in the specified page.
@@ -209,10 +214,18 @@ heap_page_prune_opt(Relation relation, Buffer buffer)
 	 * First check whether there's any chance there's something to prune,
 	 * determining the appropriate horizon is a waste if there's no prune_xid
 	 * (i.e. no updates/deletes left potentially dead tuples around).
+	 *
+	 * Such a page may however be all-visible without being marked as such
+	 * yet, typically because its tuples were bulk loaded since the last
+	 * VACUUM.  Try to mark it now, so that index-only scans need not visit
+	 * it.
 	 */
 	prune_xid = ((PageHeader) page)->pd_prune_xid;
 	if (!TransactionIdIsValid(prune_xid))
+	{
+		heap_page_set_all_visible_opt(relation, buffer);
 		return;
+	}
 
 	/*
 	 * Check whether prune_xid indicates that there may be dead rows that can
@@ -293,6 +306,156 @@ heap_page_prune_opt(Relation relation, Buffer buffer)
 	}
 }
 
+/*
+ * Optionally mark the specified page all-visible.
+ *
+ * This is called by heap_page_prune_opt() for pages that have nothing to
+ * prune.  If every tuple on the page is visible to everyone, we set
+ * PD_ALL_VISIBLE and the all-visible bit in the visibility map, as VACUUM
+ * would.  Otherwise the page stays unmarked until the next VACUUM, and
+ * index-only scans keep fetching heap tuples from it in the meantime.
+ *
+ * This works in read-only transactions too, which matters most: it's
+ * typically an index-only scan's heap fetches that bring us here.  Like
+ * on-access pruning, marking the page dirties it and writes WAL, but that
+ * happens only once per page, and afterwards the page needn't be visited
+ * again.
+ *
+ * To keep this cheap, we only look at hint bits and never consult pg_xact.
+ * A page whose hint bits haven't been set yet will usually qualify on a
+ * later visit, once the scan that's about to read it has set them.  Every
+ * check that can reject the page is made before we touch the visibility
+ * map, so a failing page costs at most one walk over its line pointers
+ * under a share lock, and the walk stops at the first tuple that
+ * disqualifies the page.  (Scans only call us when they move to a new
+ * page, so this doesn't repeat for every tuple fetched.)  We also don't
+ * wait for the exclusive buffer lock.
+ *
+ * Caller must have pin on the buffer, and must *not* have a lock on it.
+ */
+static void
+heap_page_set_all_visible_opt(Relation relation, Buffer buffer)
+{
+	Page		page = BufferGetPage(buffer);
+	BlockNumber blkno = BufferGetBlockNumber(buffer);
+	GlobalVisState *vistest;
+	TransactionId visibility_cutoff_xid;
+	Buffer		vmbuffer = InvalidBuffer;
+	bool		all_visible;
+
+	/*
+	 * Checking this without a lock is OK for the same reason as the free
+	 * space check in heap_page_prune_opt(): we recheck it below.
+	 */
+	if (PageIsAllVisible(page))
+		return;
+
+	vistest = GlobalVisTestFor(relation);
+
+	/* Check whether the page qualifies, without blocking other readers */
+	LockBuffer(buffer, BUFFER_LOCK_SHARE);
+	all_visible = heap_page_hinted_all_visible(page, vistest,
+											   &visibility_cutoff_xid);
+	LockBuffer(buffer, BUFFER_LOCK_UNLOCK);
+
+	if (!all_visible)
+		return;
+
+	/*
+	 * Pin the visibility map page first, as that might require I/O or
+	 * extending the map, which VACUUM would have to do for this page anyway.
+	 */
+	visibilitymap_pin(relation, blkno, &vmbuffer);
+
+	if (ConditionalLockBuffer(buffer))
+	{
+		/* Recheck, now that no one can change the page under us */
+		if (!PageIsAllVisible(page) &&
+			heap_page_hinted_all_visible(page, vistest,
+										 &visibility_cutoff_xid))
+		{
+			PageSetAllVisible(page);
+			MarkBufferDirty(buffer);
+			visibilitymap_set(relation, blkno, buffer, InvalidXLogRecPtr,
+							  vmbuffer, visibility_cutoff_xid,
+							  VISIBILITYMAP_ALL_VISIBLE);
+		}
+		LockBuffer(buffer, BUFFER_LOCK_UNLOCK);
+	}
+
+	ReleaseBuffer(vmbuffer);
+}
+
+/*
+ * Check, based on hint bits alone, whether all tuples on the page are
+ * visible to everyone according to vistest.
+ *
+ * This is a conservative version of the check VACUUM does in
+ * heap_page_is_all_visible(): tuples that were deleted or locked, or whose
+ * inserting transaction isn't known committed from its hint bits, make us
+ * return false.  On success, *visibility_cutoff_xid is set to the newest
+ * xmin on the page, for use in visibilitymap_set().
+ *
+ * Caller must hold at least a share lock on the buffer.
+ */
+static bool
+heap_page_hinted_all_visible(Page page, GlobalVisState *vistest,
+							 TransactionId *visibility_cutoff_xid)
+{
+	OffsetNumber offnum,
+				maxoff;
+
+	*visibility_cutoff_xid = InvalidTransactionId;
+
+	if (PageIsNew(page))
+		return false;
+
+	maxoff = PageGetMaxOffsetNumber(page);
+	for (offnum = FirstOffsetNumber;
+		 offnum <= maxoff;
+		 offnum = OffsetNumberNext(offnum))
+	{
+		ItemId		itemid = PageGetItemId(page, offnum);
+		HeapTupleHeader htup;
+		TransactionId xmin;
+
+		/* Unused or redirect line pointers are of no interest */
+		if (!ItemIdIsUsed(itemid) || ItemIdIsRedirected(itemid))
+			continue;
+
+		/* Dead line pointers can have index pointers pointing to them */
+		if (ItemIdIsDead(itemid))
+			return false;
+
+		htup = (HeapTupleHeader) PageGetItem(page, itemid);
+
+		/* The tuple must not have been deleted, updated or locked */
+		if (!(htup->t_infomask & HEAP_XMAX_INVALID))
+			return false;
+
+		if (HeapTupleHeaderXminFrozen(htup))
+			continue;
+
+		/*
+		 * The inserter must be known committed, and old enough that everyone
+		 * sees it as committed.
+		 */
+		if (!HeapTupleHeaderXminCommitted(htup))
+			return false;
+
+		xmin = HeapTupleHeaderGetRawXmin(htup);
+		if (!TransactionIdIsNormal(xmin) ||
+			!GlobalVisTestIsRemovableXid(vistest, xmin))
+			return false;
+
+		/* Track newest xmin on page */
+		if (TransactionIdFollows(xmin, *visibility_cutoff_xid))
+			*visibility_cutoff_xid = xmin;
+	}
+
+	return true;
+}
+
 
 /*
  * Prune and repair fragmentation and potentially freeze tuples on the
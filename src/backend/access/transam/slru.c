@@ -148,6 +148,15 @@ typedef struct SlruWriteAllData *SlruWriteAll;
 #define SlotGetBankNumber(slotno)	((slotno) >> SLRU_BANK_BITSHIFT)
 
 
+/*
+ * Number of pages following the current one that we ask the kernel to read
+ * ahead once we notice that a backend is reading an SLRU sequentially, as
+ * happens when checking the status of many old XIDs whose hint bits aren't
+ * set yet.
+ */
+#define SLRU_READAHEAD_PAGES	8
+
+
 /*
  * Populate a file tag describing a segment file.  We only use the segment
  * number, since we can derive everything else we need by having separate
@@ -179,6 +188,7 @@ static void SimpleLruZeroLSNs(SlruCtl ctl, int slotno);
 static void SimpleLruWaitIO(SlruCtl ctl, int slotno);
 static void SlruInternalWritePage(SlruCtl ctl, int slotno, SlruWriteAll fdata);
 static bool SlruPhysicalReadPage(SlruCtl ctl, int64 pageno, int slotno);
+static void SlruReadAhead(SlruCtl ctl, int fd, int64 pageno);
 static bool SlruPhysicalWritePage(SlruCtl ctl, int64 pageno, int slotno,
 								  SlruWriteAll fdata);
 static void SlruReportIOError(SlruCtl ctl, int64 pageno, TransactionId xid);
@@ -343,6 +353,8 @@ SimpleLruInit(SlruCtl ctl, const char *name, int nslots, int nlsns,
 	ctl->sync_handler = sync_handler;
 	ctl->long_segment_names = long_segment_names;
 	ctl->nbanks = nbanks;
+	ctl->last_read_pageno = -1;
+	ctl->readahead_pageno = -1;
 	strlcpy(ctl->Dir, subdir, sizeof(ctl->Dir));
 }
 
@@ -847,6 +859,17 @@ SlruPhysicalReadPage(SlruCtl ctl, int64 pageno, int slotno)
 	}
 	pgstat_report_wait_end();
 
+	/*
+	 * If this read continues a sequential pattern, the following pages are
+	 * likely to be needed soon too.  Ask the kernel to start reading them, so
+	 * that the misses to come don't each have to wait for synchronous I/O.
+	 */
+	if (pageno == ctl->last_read_pageno + 1)
+		SlruReadAhead(ctl, fd, pageno);
+	else
+		ctl->readahead_pageno = -1;
+	ctl->last_read_pageno = pageno;
+
 	if (CloseTransientFile(fd) != 0)
 	{
 		slru_errcause = SLRU_CLOSE_FAILED;
@@ -857,6 +880,35 @@ SlruPhysicalReadPage(SlruCtl ctl, int64 pageno, int slotno)
 	return true;
 }
 
+/*
+ * Issue read-ahead advice for the pages following pageno, up to
+ * SLRU_READAHEAD_PAGES of them, skipping pages already advised.  fd is the
+ * open segment file containing pageno; we don't look past its end.
+ *
+ * This is only a hint, so errors are ignored.
+ */
+static void
+SlruReadAhead(SlruCtl ctl, int fd, int64 pageno)
+{
+#if defined(USE_POSIX_FADVISE) && defined(POSIX_FADV_WILLNEED)
+	int64		segno = pageno / SLRU_PAGES_PER_SEGMENT;
+	int64		segend = (segno + 1) * SLRU_PAGES_PER_SEGMENT - 1;
+	int64		start;
+	int64		end;
+
+	start = Max(pageno, ctl->readahead_pageno) + 1;
+	end = Min(pageno + SLRU_READAHEAD_PAGES, segend);
+	if (start > end)
+		return;
+
+	(void) posix_fadvise(fd,
+						 (off_t) (start % SLRU_PAGES_PER_SEGMENT) * BLCKSZ,
+						 (off_t) (end - start + 1) * BLCKSZ,
+						 POSIX_FADV_WILLNEED);
+	ctl->readahead_pageno = end;
+#endif
+}
+
 /*
  * Physical write of a page from a buffer slot
  *
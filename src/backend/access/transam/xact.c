@@ -62,6 +62,7 @@
 #include "storage/sinvaladt.h"
 #include "storage/smgr.h"
 #include "utils/builtins.h"
+#include "utils/catcache.h"
 #include "utils/combocid.h"
 #include "utils/guc.h"
 #include "utils/inval.h"
@@ -917,6 +918,9 @@ SetCurrentStatementStartTimestamp(void)
 		stmtStartTimestamp = GetCurrentTimestamp();
 	else
 		Assert(stmtStartTimestamp != 0);
+
+	/* Also advance the clock used to age catalog cache entries */
+	SetCatCacheClock(stmtStartTimestamp);
 }
 
 /*
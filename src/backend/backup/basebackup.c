@@ -1600,6 +1600,18 @@ sendFile(bbsink *sink, const char *readfilename, const char *tarfilename,
 				 errmsg("could not open file \"%s\": %m", readfilename)));
 	}
 
+#if defined(USE_POSIX_FADVISE) && defined(POSIX_FADV_SEQUENTIAL)
+
+	/*
+	 * Unless we're only sending selected blocks for an incremental backup,
+	 * the whole file is read front to back, so ask the kernel to read ahead
+	 * more aggressively.  Reading is often the bottleneck of a base backup,
+	 * since only one process does it.
+	 */
+	if (incremental_blocks == NULL)
+		(void) posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
 	_tarWriteHeader(sink, tarfilename, NULL, statbuf, false);
 
 	/*
@@ -1858,6 +1858,8 @@ typedef struct
 typedef struct
 {
 	SortSupport ssup;
+	Datum	   *abbrevs;		/* abbreviated keys indexed by tupno, if
+								 * ssup->abbrev_converter is set */
 	int		   *tupnoLink;
 } CompareScalarsContext;
 
@@ -2416,6 +2418,8 @@ compute_scalar_stats(VacAttrStatsP stats,
 	double		corr_xysum;
 	SortSupportData ssup;
 	ScalarItem *values;
+	Datum	   *abbrevs = NULL;
+	int			abbrevNext = 10;
 	int			values_cnt = 0;
 	int		   *tupnoLink;
 	ScalarMCVItem *track;
@@ -2434,14 +2438,19 @@ compute_scalar_stats(VacAttrStatsP stats,
 	ssup.ssup_nulls_first = false;
 
 	/*
-	 * For now, don't perform abbreviated key conversion, because full values
-	 * are required for MCV slot generation.  Supporting that optimization
-	 * would necessitate teaching compare_scalars() to call a tie-breaker.
+	 * Use abbreviated keys if the type supports them, as sorting is typically
+	 * the most expensive part of the job for types such as text.  We keep the
+	 * full values in the ScalarItems, since they're required for MCV slot
+	 * generation, and compare_scalars() breaks ties between abbreviated keys
+	 * using them.
 	 */
-	ssup.abbreviate = false;
+	ssup.abbreviate = true;
 
 	PrepareSortSupportFromOrderingOp(mystats->ltopr, &ssup);
 
+	if (ssup.abbrev_converter != NULL)
+		abbrevs = (Datum *) palloc(samplerows * sizeof(Datum));
+
 	/* Initial scan to find sortable values */
 	for (i = 0; i < samplerows; i++)
 	{
@@ -2490,6 +2499,26 @@ compute_scalar_stats(VacAttrStatsP stats,
 			total_width += strlen(DatumGetCString(value)) + 1;
 		}
 
+		/*
+		 * Compute the abbreviated key, unless the opclass-supplied abort
+		 * routine tells us abbreviation isn't paying off.  As in tuplesort.c,
+		 * we check that at exponentially increasing intervals.
+		 */
+		if (ssup.abbrev_converter != NULL && values_cnt >= abbrevNext)
+		{
+			abbrevNext *= 2;
+			if (ssup.abbrev_abort(values_cnt, &ssup))
+			{
+				/* Give up, and use the authoritative comparator instead */
+				ssup.comparator = ssup.abbrev_full_comparator;
+				ssup.abbrev_converter = NULL;
+				ssup.abbrev_abort = NULL;
+				ssup.abbrev_full_comparator = NULL;
+			}
+		}
+		if (ssup.abbrev_converter != NULL)
+			abbrevs[values_cnt] = ssup.abbrev_converter(value, &ssup);
+
 		/* Add it to the list to be sorted */
 		values[values_cnt].value = value;
 		values[values_cnt].tupno = values_cnt;
@@ -2509,6 +2538,7 @@ compute_scalar_stats(VacAttrStatsP stats,
 
 		/* Sort the collected values */
 		cxt.ssup = &ssup;
+		cxt.abbrevs = abbrevs;
 		cxt.tupnoLink = tupnoLink;
 		qsort_interruptible(values, values_cnt, sizeof(ScalarItem),
 							compare_scalars, &cxt);
@@ -2937,7 +2967,18 @@ compare_scalars(const void *a, const void *b, void *arg)
 	CompareScalarsContext *cxt = (CompareScalarsContext *) arg;
 	int			compare;
 
-	compare = ApplySortComparator(da, false, db, false, cxt->ssup);
+	if (cxt->ssup->abbrev_converter != NULL)
+	{
+		/* Compare abbreviated keys, falling back to full values on a tie */
+		compare = ApplySortComparator(cxt->abbrevs[ta], false,
+									  cxt->abbrevs[tb], false,
+									  cxt->ssup);
+		if (compare == 0)
+			compare = ApplySortAbbrevFullComparator(da, false, db, false,
+													cxt->ssup);
+	}
+	else
+		compare = ApplySortComparator(da, false, db, false, cxt->ssup);
 	if (compare != 0)
 		return compare;
 
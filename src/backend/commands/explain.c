@@ -3650,6 +3650,7 @@ show_memoize_info(MemoizeState *mstate, List *ancestors, ExplainState *es)
 			ExplainPropertyInteger("Cache Misses", NULL, mstate->stats.cache_misses, es);
 			ExplainPropertyInteger("Cache Evictions", NULL, mstate->stats.cache_evictions, es);
 			ExplainPropertyInteger("Cache Overflows", NULL, mstate->stats.cache_overflows, es);
+			ExplainPropertyInteger("Cache Bypasses", NULL, mstate->stats.cache_bypasses, es);
 			ExplainPropertyInteger("Peak Memory Usage", "kB", memPeakKb, es);
 		}
 		else
@@ -3662,6 +3663,15 @@ show_memoize_info(MemoizeState *mstate, List *ancestors, ExplainState *es)
 							 mstate->stats.cache_evictions,
 							 mstate->stats.cache_overflows,
 							 memPeakKb);
+
+			/* Only mention bypassed lookups if caching was given up on */
+			if (mstate->stats.cache_bypasses > 0)
+			{
+				ExplainIndentText(es);
+				appendStringInfo(es->str,
+								 "Caching Disabled  Bypassed Lookups: " UINT64_FORMAT "\n",
+								 mstate->stats.cache_bypasses);
+			}
 		}
 	}
 
@@ -3701,6 +3711,14 @@ show_memoize_info(MemoizeState *mstate, List *ancestors, ExplainState *es)
 							 si->cache_hits, si->cache_misses,
 							 si->cache_evictions, si->cache_overflows,
 							 memPeakKb);
+
+			if (si->cache_bypasses > 0)
+			{
+				ExplainIndentText(es);
+				appendStringInfo(es->str,
+								 "Caching Disabled  Bypassed Lookups: " UINT64_FORMAT "\n",
+								 si->cache_bypasses);
+			}
 		}
 		else
 		{
@@ -3712,6 +3730,8 @@ show_memoize_info(MemoizeState *mstate, List *ancestors, ExplainState *es)
 								   si->cache_evictions, es);
 			ExplainPropertyInteger("Cache Overflows", NULL,
 								   si->cache_overflows, es);
+			ExplainPropertyInteger("Cache Bypasses", NULL,
+								   si->cache_bypasses, es);
 			ExplainPropertyInteger("Peak Memory Usage", "kB", memPeakKb,
 								   es);
 		}
@@ -13,6 +13,7 @@
  */
 #include "postgres.h"
 
+#include "access/stratnum.h"
 #include "access/table.h"
 #include "access/tableam.h"
 #include "catalog/partition.h"
@@ -32,6 +33,7 @@
 #include "utils/partcache.h"
 #include "utils/rls.h"
 #include "utils/ruleutils.h"
+#include "utils/sortsupport.h"
 
 
 /*-----------------------
@@ -121,6 +123,11 @@ struct PartitionTupleRouting
  * partdesc
  *		Partition descriptor of the table
  *
+ * partsortsupport
+ *		Array of SortSupport structs, one per partition key column, used for
+ *		comparing partition key values to the bounds of a LIST or RANGE
+ *		partitioned table; NULL for HASH partitioning.
+ *
  * tupslot
  *		A standalone TupleTableSlot initialized with this table's tuple
  *		descriptor, or NULL if no tuple conversion between the parent is
@@ -147,6 +154,7 @@ typedef struct PartitionDispatchData
 	PartitionKey key;
 	List	   *keystate;		/* list of ExprState */
 	PartitionDesc partdesc;
+	SortSupport partsortsupport;	/* array of partnatts elements, or NULL */
 	TupleTableSlot *tupslot;
 	AttrMap    *tupmap;
 	int			indexes[FLEXIBLE_ARRAY_MEMBER];
@@ -1138,6 +1146,44 @@ ExecInitPartitionDispatchInfo(EState *estate,
 	pd->key = RelationGetPartitionKey(rel);
 	pd->keystate = NIL;
 	pd->partdesc = partdesc;
+
+	/*
+	 * Tuple routing compares each row's partition key to the bounds of LIST
+	 * and RANGE partitioned tables by binary search, so set up SortSupport
+	 * for each key column.  For many common types, this provides a
+	 * comparator that is much cheaper to call than the btree comparison
+	 * function via fmgr.
+	 */
+	if (pd->key->strategy != PARTITION_STRATEGY_HASH)
+	{
+		PartitionKey key = pd->key;
+
+		pd->partsortsupport = (SortSupport)
+			palloc0(sizeof(SortSupportData) * key->partnatts);
+		for (int i = 0; i < key->partnatts; i++)
+		{
+			SortSupport ssup = &pd->partsortsupport[i];
+			Oid			opno;
+
+			opno = get_opfamily_member(key->partopfamily[i],
+									   key->partopcintype[i],
+									   key->partopcintype[i],
+									   BTLessStrategyNumber);
+			if (!OidIsValid(opno))
+				elog(ERROR, "missing operator %d(%u,%u) in opfamily %u",
+					 BTLessStrategyNumber, key->partopcintype[i],
+					 key->partopcintype[i], key->partopfamily[i]);
+
+			ssup->ssup_cxt = proute->memcxt;
+			ssup->ssup_collation = key->partcollation[i];
+			ssup->ssup_nulls_first = false;
+			ssup->abbreviate = false;
+			PrepareSortSupportFromOrderingOp(opno, ssup);
+		}
+	}
+	else
+		pd->partsortsupport = NULL;
+
 	if (parent_pd != NULL)
 	{
 		TupleDesc	tupdesc = RelationGetDescr(rel);
@@ -1462,10 +1508,9 @@ get_partition_for_tuple(PartitionDispatch pd, Datum *values, bool *isnull)
 					int32		cmpval;
 
 					/* does the last found datum index match this datum? */
-					cmpval = DatumGetInt32(FunctionCall2Coll(&key->partsupfunc[0],
-															 key->partcollation[0],
-															 lastDatum,
-															 values[0]));
+					cmpval = ApplySortComparator(lastDatum, false,
+												 values[0], false,
+												 &pd->partsortsupport[0]);
 
 					if (cmpval == 0)
 						return boundinfo->indexes[last_datum_offset];
@@ -1473,10 +1518,9 @@ get_partition_for_tuple(PartitionDispatch pd, Datum *values, bool *isnull)
 					/* fall-through and do a manual lookup */
 				}
 
-				bound_offset = partition_list_bsearch(key->partsupfunc,
-													  key->partcollation,
-													  boundinfo,
-													  values[0], &equal);
+				bound_offset = partition_list_bsearch_ssup(pd->partsortsupport,
+														   boundinfo,
+														   values[0], &equal);
 				if (bound_offset >= 0 && equal)
 					part_index = boundinfo->indexes[bound_offset];
 			}
@@ -1513,12 +1557,11 @@ get_partition_for_tuple(PartitionDispatch pd, Datum *values, bool *isnull)
 					int32		cmpval;
 
 					/* check if the value is >= to the lower bound */
-					cmpval = partition_rbound_datum_cmp(key->partsupfunc,
-														key->partcollation,
-														lastDatums,
-														kind,
-														values,
-														key->partnatts);
+					cmpval = partition_rbound_datum_cmp_ssup(pd->partsortsupport,
+															 lastDatums,
+															 kind,
+															 values,
+															 key->partnatts);
 
 					/*
 					 * If it's equal to the lower bound then no need to check
@@ -1532,12 +1575,11 @@ get_partition_for_tuple(PartitionDispatch pd, Datum *values, bool *isnull)
 						/* check if the value is below the upper bound */
 						lastDatums = boundinfo->datums[last_datum_offset + 1];
 						kind = boundinfo->kind[last_datum_offset + 1];
-						cmpval = partition_rbound_datum_cmp(key->partsupfunc,
-															key->partcollation,
-															lastDatums,
-															kind,
-															values,
-															key->partnatts);
+						cmpval = partition_rbound_datum_cmp_ssup(pd->partsortsupport,
+																 lastDatums,
+																 kind,
+																 values,
+																 key->partnatts);
 
 						if (cmpval > 0)
 							return boundinfo->indexes[last_datum_offset + 1];
@@ -1545,12 +1587,11 @@ get_partition_for_tuple(PartitionDispatch pd, Datum *values, bool *isnull)
 					/* fall-through and do a manual lookup */
 				}
 
-				bound_offset = partition_range_datum_bsearch(key->partsupfunc,
-															 key->partcollation,
-															 boundinfo,
-															 key->partnatts,
-															 values,
-															 &equal);
+				bound_offset = partition_range_datum_bsearch_ssup(pd->partsortsupport,
+																  boundinfo,
+																  key->partnatts,
+																  values,
+																  &equal);
 
 				/*
 				 * The bound at bound_offset is less than or equal to the
@@ -2077,6 +2118,34 @@ CreatePartitionPruneState(EState *estate, PartitionPruneInfo *pruneinfo,
 							  "Partition Prune",
 							  ALLOCSET_DEFAULT_SIZES);
 
+	/*
+	 * Determine up front whether exec pruning will be needed at any level.
+	 * Only in that case will InitExecPartitionPruneContexts() modify the
+	 * subplan_map arrays and present_parts sets; otherwise we can use the
+	 * ones in the PartitionedRelPruneInfos directly, rather than copying
+	 * them, which costs time proportional to the number of partitions on
+	 * every executor startup.
+	 */
+	if (!(estate->es_top_eflags & EXEC_FLAG_EXPLAIN_GENERIC))
+	{
+		foreach(lc, pruneinfo->prune_infos)
+		{
+			List	   *partrelpruneinfos = lfirst_node(List, lc);
+			ListCell   *lc2;
+
+			foreach(lc2, partrelpruneinfos)
+			{
+				PartitionedRelPruneInfo *pinfo = lfirst_node(PartitionedRelPruneInfo, lc2);
+
+				if (pinfo->exec_pruning_steps)
+				{
+					prunestate->do_exec_prune = true;
+					break;
+				}
+			}
+		}
+	}
+
 	i = 0;
 	foreach(lc, pruneinfo->prune_infos)
 	{
@@ -2122,8 +2191,9 @@ CreatePartitionPruneState(EState *estate, PartitionPruneInfo *pruneinfo,
 			 * The set of partitions that exist now might not be the same that
 			 * existed when the plan was made.  The normal case is that it is;
 			 * optimize for that case with a quick comparison, and just copy
-			 * the subplan_map and make subpart_map, leafpart_rti_map point to
-			 * the ones in PruneInfo.
+			 * the subplan_map (or just point to it, if it won't be modified)
+			 * and make subpart_map, leafpart_rti_map point to the ones in
+			 * PruneInfo.
 			 *
 			 * For the case where they aren't identical, we could have more
 			 * partitions on either side; or even exactly the same number of
@@ -2135,7 +2205,6 @@ CreatePartitionPruneState(EState *estate, PartitionPruneInfo *pruneinfo,
 			 * arrays are in partition bounds order.
 			 */
 			pprune->nparts = partdesc->nparts;
-			pprune->subplan_map = palloc(sizeof(int) * partdesc->nparts);
 
 			if (partdesc->nparts == pinfo->nparts &&
 				memcmp(partdesc->oids, pinfo->relid_map,
@@ -2143,8 +2212,14 @@ CreatePartitionPruneState(EState *estate, PartitionPruneInfo *pruneinfo,
 			{
 				pprune->subpart_map = pinfo->subpart_map;
 				pprune->leafpart_rti_map = pinfo->leafpart_rti_map;
-				memcpy(pprune->subplan_map, pinfo->subplan_map,
-					   sizeof(int) * pinfo->nparts);
+				if (prunestate->do_exec_prune)
+				{
+					pprune->subplan_map = palloc(sizeof(int) * pinfo->nparts);
+					memcpy(pprune->subplan_map, pinfo->subplan_map,
+						   sizeof(int) * pinfo->nparts);
+				}
+				else
+					pprune->subplan_map = pinfo->subplan_map;
 			}
 			else
 			{
@@ -2162,6 +2237,7 @@ CreatePartitionPruneState(EState *estate, PartitionPruneInfo *pruneinfo,
 				 * attached.  Cope with that by creating a map that skips any
 				 * mismatches.
 				 */
+				pprune->subplan_map = palloc(sizeof(int) * partdesc->nparts);
 				pprune->subpart_map = palloc(sizeof(int) * partdesc->nparts);
 				pprune->leafpart_rti_map = palloc(sizeof(int) * partdesc->nparts);
 
@@ -2225,7 +2301,10 @@ CreatePartitionPruneState(EState *estate, PartitionPruneInfo *pruneinfo,
 			}
 
 			/* present_parts is also subject to later modification */
-			pprune->present_parts = bms_copy(pinfo->present_parts);
+			if (prunestate->do_exec_prune)
+				pprune->present_parts = bms_copy(pinfo->present_parts);
+			else
+				pprune->present_parts = pinfo->present_parts;
 
 			/*
 			 * Only initial_context is initialized here.  exec_context is
@@ -2247,13 +2326,8 @@ CreatePartitionPruneState(EState *estate, PartitionPruneInfo *pruneinfo,
 				/* Record whether initial pruning is needed at any level */
 				prunestate->do_initial_prune = true;
 			}
+			/* do_exec_prune was already determined above */
 			pprune->exec_pruning_steps = pinfo->exec_pruning_steps;
-			if (pinfo->exec_pruning_steps &&
-				!(econtext->ecxt_estate->es_top_eflags & EXEC_FLAG_EXPLAIN_GENERIC))
-			{
-				/* Record whether exec pruning is needed at any level */
-				prunestate->do_exec_prune = true;
-			}
 
 			/*
 			 * Accumulate the IDs of all PARAM_EXEC Params affecting the
@@ -50,6 +50,16 @@
  * demanding, then that may allow us to start putting useful entries back into
  * the cache again.
  *
+ * The planner's decision to use a Memoize node is based on its estimate of
+ * the number of distinct parameter values, which can be badly wrong.  When
+ * the cache turns out to be full and almost every lookup misses, caching
+ * tuples is pure overhead, as we're only evicting entries that won't be
+ * looked up again.  So, every MEMO_BYPASS_CHECK_INTERVAL lookups, we check
+ * the hit ratio seen since caching was last (re)enabled, and if it's hopeless we empty the cache and
+ * stop caching altogether, just passing the subplan's tuples through.  This
+ * lasts until a parameter that's not part of the cache key changes, at which
+ * point the cache would have had to be purged anyway.
+ *
  *
  * INTERFACE ROUTINES
  *		ExecMemoize			- lookup cache, exec subplan when not found
@@ -82,6 +92,13 @@
 										 * subplan without caching anything */
 #define MEMO_END_OF_SCAN			5	/* Ready for rescan */
 
+/*
+ * How often (in cache lookups) to check whether the cache is worth keeping,
+ * and the hit ratio below which we give up on it.
+ */
+#define MEMO_BYPASS_CHECK_INTERVAL	4096
+#define MEMO_BYPASS_MIN_HIT_RATIO	0.01
+
 
 /* Helper macros for memory accounting */
 #define EMPTY_ENTRY_MEMORY_BYTES(e)		(sizeof(MemoizeEntry) + \
@@ -508,6 +525,7 @@ cache_reduce_memory(MemoizeState *mstate, MemoizeKey *specialkey)
 	}
 
 	mstate->stats.cache_evictions += evictions; /* Update Stats */
+	mstate->window_evictions += evictions;
 
 	return specialkey_intact;
 }
@@ -719,6 +737,42 @@ ExecMemoize(PlanState *pstate)
 
 				Assert(node->entry == NULL);
 
+				/*
+				 * Periodically check whether the cache is achieving anything.
+				 * If it's been full and we've seen hardly any hits, give up on
+				 * caching.  See the comments at the top of the file.
+				 */
+				if (unlikely(!node->cache_disabled &&
+							 node->window_evictions > 0 &&
+							 node->window_lookups % MEMO_BYPASS_CHECK_INTERVAL == 0 &&
+							 node->window_hits <
+							 node->window_lookups * MEMO_BYPASS_MIN_HIT_RATIO))
+				{
+					cache_purge_all(node);
+					node->cache_disabled = true;
+				}
+
+				if (unlikely(node->cache_disabled))
+				{
+					node->stats.cache_misses += 1;	/* stats update */
+					node->stats.cache_bypasses += 1;	/* stats update */
+
+					outerNode = outerPlanState(node);
+					outerslot = ExecProcNode(outerNode);
+					if (TupIsNull(outerslot))
+					{
+						node->mstatus = MEMO_END_OF_SCAN;
+						return NULL;
+					}
+
+					/* Read the remaining tuples in bypass mode */
+					node->mstatus = MEMO_CACHE_BYPASS_MODE;
+
+					slot = node->ss.ps.ps_ResultTupleSlot;
+					ExecCopySlot(slot, outerslot);
+					return slot;
+				}
+
 				/* first call? we'll need a hash table. */
 				if (unlikely(node->hashtable == NULL))
 					build_hash_table(node, ((Memoize *) pstate->plan)->est_entries);
@@ -738,10 +792,12 @@ ExecMemoize(PlanState *pstate)
 
 				/* see if we've got anything cached for the current parameters */
 				entry = cache_lookup(node, &found);
+				node->window_lookups += 1;
 
 				if (found && entry->complete)
 				{
 					node->stats.cache_hits += 1;	/* stats update */
+					node->window_hits += 1;
 
 					/*
 					 * Set last_tuple and entry so that the state
@@ -1063,6 +1119,10 @@ ExecInitMemoize(Memoize *node, EState *estate, int eflags)
 	 * using the type's hash equality operator
 	 */
 	mstate->binary_mode = node->binary_mode;
+	mstate->cache_disabled = false;
+	mstate->window_lookups = 0;
+	mstate->window_hits = 0;
+	mstate->window_evictions = 0;
 
 	/* Zero the statistics counters */
 	memset(&mstate->stats, 0, sizeof(MemoizeInstrumentation));
@@ -1160,7 +1220,18 @@ ExecReScanMemoize(MemoizeState *node)
 	 * cache key.
 	 */
 	if (bms_nonempty_difference(outerPlan->chgParam, node->keyparamids))
+	{
 		cache_purge_all(node);
+
+		/*
+		 * The cache may well be more useful for the new parameter values.
+		 * Judge it on its performance from here on.
+		 */
+		node->cache_disabled = false;
+		node->window_lookups = 0;
+		node->window_hits = 0;
+		node->window_evictions = 0;
+	}
 }
 
 /*
@@ -222,6 +222,8 @@ static const PagetableEntry *tbm_find_pageentry(const TIDBitmap *tbm,
 												BlockNumber pageno);
 static PagetableEntry *tbm_get_pageentry(TIDBitmap *tbm, BlockNumber pageno);
 static bool tbm_page_is_lossy(const TIDBitmap *tbm, BlockNumber pageno);
+static PagetableEntry *tbm_get_chunkentry(TIDBitmap *tbm,
+										  BlockNumber chunk_pageno);
 static void tbm_mark_page_lossy(TIDBitmap *tbm, BlockNumber pageno);
 static void tbm_lossify(TIDBitmap *tbm);
 static int	tbm_comparator(const void *left, const void *right);
@@ -438,6 +440,75 @@ tbm_add_page(TIDBitmap *tbm, BlockNumber pageno)
 		tbm_lossify(tbm);
 }
 
+/*
+ * tbm_add_page_range - add a consecutive run of whole pages to a TIDBitmap
+ *
+ * This is equivalent to calling tbm_add_page() for each page from firstpage
+ * to lastpage inclusive, but touches each lossy chunk only once rather than
+ * once per page.  Callers such as BRIN, which report matches in runs of
+ * many pages, benefit from this considerably.
+ */
+void
+tbm_add_page_range(TIDBitmap *tbm, BlockNumber firstpage, BlockNumber lastpage)
+{
+	BlockNumber pageno = firstpage;
+
+	Assert(firstpage <= lastpage);
+
+	/* We force the bitmap into hashtable mode whenever it's lossy */
+	if (tbm->status != TBM_HASH)
+		tbm_create_pagetable(tbm);
+
+	for (;;)
+	{
+		BlockNumber chunk_pageno = pageno - pageno % PAGES_PER_CHUNK;
+		BlockNumber chunk_lastpage;
+		PagetableEntry *page;
+		int			bitno;
+
+		chunk_lastpage = Min(lastpage, chunk_pageno + (PAGES_PER_CHUNK - 1));
+
+		/*
+		 * Remove any extant non-lossy entries for the pages of this chunk that
+		 * we're about to mark.  The chunk header page itself is handled by
+		 * tbm_get_chunkentry.  There can't be any such entries if the bitmap
+		 * holds no exact pages, which is the common case for BRIN.
+		 */
+		if (tbm->npages > 0)
+		{
+			BlockNumber delpage;
+
+			for (delpage = Max(pageno, chunk_pageno + 1);
+				 delpage <= chunk_lastpage;
+				 delpage++)
+			{
+				if (pagetable_delete(tbm->pagetable, delpage))
+				{
+					/* It was present, so adjust counts */
+					tbm->nentries--;
+					tbm->npages--;	/* assume it must have been non-lossy */
+				}
+			}
+		}
+
+		page = tbm_get_chunkentry(tbm, chunk_pageno);
+
+		/* Now set the bits of all target pages within this chunk */
+		for (bitno = pageno - chunk_pageno;
+			 bitno <= chunk_lastpage - chunk_pageno;
+			 bitno++)
+			page->words[WORDNUM(bitno)] |= ((bitmapword) 1 << BITNUM(bitno));
+
+		if (chunk_lastpage == lastpage)
+			break;
+		pageno = chunk_lastpage + 1;
+	}
+
+	/* If we went over the memory limit, lossify some more pages */
+	if (tbm->nentries > tbm->maxentries)
+		tbm_lossify(tbm);
+}
+
 /*
  * tbm_union - set union
  *
@@ -1278,41 +1349,20 @@ tbm_page_is_lossy(const TIDBitmap *tbm, BlockNumber pageno)
 }
 
 /*
- * tbm_mark_page_lossy - mark the page number as lossily stored
+ * tbm_get_chunkentry - find or create the lossy chunk header for a chunk
  *
- * This may cause the table to exceed the desired memory size.  It is
- * up to the caller to call tbm_lossify() at the next safe point if so.
+ * chunk_pageno must be a multiple of PAGES_PER_CHUNK, and the bitmap must
+ * already be in hashtable mode.  If the chunk header page was previously
+ * stored as an exact page, it is converted into a lossy chunk entry.
  */
-static void
-tbm_mark_page_lossy(TIDBitmap *tbm, BlockNumber pageno)
+static PagetableEntry *
+tbm_get_chunkentry(TIDBitmap *tbm, BlockNumber chunk_pageno)
 {
 	PagetableEntry *page;
 	bool		found;
-	BlockNumber chunk_pageno;
-	int			bitno;
-	int			wordnum;
-	int			bitnum;
 
-	/* We force the bitmap into hashtable mode whenever it's lossy */
-	if (tbm->status != TBM_HASH)
-		tbm_create_pagetable(tbm);
-
-	bitno = pageno % PAGES_PER_CHUNK;
-	chunk_pageno = pageno - bitno;
-
-	/*
-	 * Remove any extant non-lossy entry for the page.  If the page is its own
-	 * chunk header, however, we skip this and handle the case below.
-	 */
-	if (bitno != 0)
-	{
-		if (pagetable_delete(tbm->pagetable, pageno))
-		{
-			/* It was present, so adjust counts */
-			tbm->nentries--;
-			tbm->npages--;		/* assume it must have been non-lossy */
-		}
-	}
+	Assert(tbm->status == TBM_HASH);
+	Assert(chunk_pageno % PAGES_PER_CHUNK == 0);
 
 	/* Look up or create entry for chunk-header page */
 	page = pagetable_insert(tbm->pagetable, chunk_pageno, &found);
@@ -1346,6 +1396,48 @@ tbm_mark_page_lossy(TIDBitmap *tbm, BlockNumber pageno)
 		tbm->npages--;
 	}
 
+	return page;
+}
+
+/*
+ * tbm_mark_page_lossy - mark the page number as lossily stored
+ *
+ * This may cause the table to exceed the desired memory size.  It is
+ * up to the caller to call tbm_lossify() at the next safe point if so.
+ */
+static void
+tbm_mark_page_lossy(TIDBitmap *tbm, BlockNumber pageno)
+{
+	PagetableEntry *page;
+	BlockNumber chunk_pageno;
+	int			bitno;
+	int			wordnum;
+	int			bitnum;
+
+	/* We force the bitmap into hashtable mode whenever it's lossy */
+	if (tbm->status != TBM_HASH)
+		tbm_create_pagetable(tbm);
+
+	bitno = pageno % PAGES_PER_CHUNK;
+	chunk_pageno = pageno - bitno;
+
+	/*
+	 * Remove any extant non-lossy entry for the page.  If the page is its own
+	 * chunk header, however, we skip this and handle the case below.
+	 */
+	if (bitno != 0)
+	{
+		if (pagetable_delete(tbm->pagetable, pageno))
+		{
+			/* It was present, so adjust counts */
+			tbm->nentries--;
+			tbm->npages--;		/* assume it must have been non-lossy */
+		}
+	}
+
+	/* Look up or create entry for chunk-header page */
+	page = tbm_get_chunkentry(tbm, chunk_pageno);
+
 	/* Now set the original target page's bit */
 	wordnum = WORDNUM(bitno);
 	bitnum = BITNUM(bitno);
@@ -154,6 +154,17 @@ clauselist_selectivity_ext(PlannerInfo *root,
 											jointype, sjinfo, rel,
 											&estimatedclauses, false);
 	}
+	else if (use_extended_stats && rel == NULL && varRelid == 0)
+	{
+		/*
+		 * These are join clauses.  Try to estimate groups of equijoin clauses
+		 * that join the same pair of relations on several columns using
+		 * extended statistics, rather than assuming the columns are
+		 * independent.
+		 */
+		s1 = estimate_multivariate_eqjoinsel(root, clauses, jointype, sjinfo,
+											 &estimatedclauses);
+	}
 
 	/*
 	 * Apply normal selectivity estimates for remaining clauses. We'll be
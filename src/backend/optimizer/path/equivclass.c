@@ -3147,9 +3147,10 @@ bool
 have_relevant_eclass_joinclause(PlannerInfo *root,
 								RelOptInfo *rel1, RelOptInfo *rel2)
 {
-	Bitmapset  *matching_ecs;
 	int			i;
 
+	Assert(root->ec_merging_done);
+
 	/*
 	 * Examine only eclasses mentioning both rel1 and rel2.
 	 *
@@ -3159,19 +3160,25 @@ have_relevant_eclass_joinclause(PlannerInfo *root,
 	 * correctly enforced when we form the outer join, they don't seem like
 	 * sufficient reason to prioritize this join over other ones.  The join
 	 * ordering rules will force the join to be made when necessary.
+	 *
+	 * This is called for a great many pairs of rels during join search, so
+	 * we rely on each rel's eclass_indexes (which for a join rel is the union
+	 * of its inputs' sets) rather than rebuilding the sets from the relids,
+	 * and we avoid building the intersection of the two.
 	 */
-	matching_ecs = get_common_eclass_indexes(root, rel1->relids,
-											 rel2->relids);
-
 	i = -1;
-	while ((i = bms_next_member(matching_ecs, i)) >= 0)
+	while ((i = bms_next_member(rel1->eclass_indexes, i)) >= 0)
 	{
-		EquivalenceClass *ec = (EquivalenceClass *) list_nth(root->eq_classes,
-															 i);
+		EquivalenceClass *ec;
+
+		if (!bms_is_member(i, rel2->eclass_indexes))
+			continue;
+
+		ec = (EquivalenceClass *) list_nth(root->eq_classes, i);
 
 		/*
-		 * Sanity check that get_common_eclass_indexes gave only ECs
-		 * containing both rels.
+		 * Sanity check that the eclass_indexes sets gave only ECs containing
+		 * both rels.
 		 */
 		Assert(bms_overlap(rel1->relids, ec->ec_relids));
 		Assert(bms_overlap(rel2->relids, ec->ec_relids));
@@ -3186,7 +3193,7 @@ have_relevant_eclass_joinclause(PlannerInfo *root,
 		/*
 		 * We do not need to examine the individual members of the EC, because
 		 * all that we care about is whether each rel overlaps the relids of
-		 * at least one member, and get_common_eclass_indexes() and the single
+		 * at least one member, and the eclass_indexes test and the single
 		 * member check above are sufficient to prove that.  (As with
 		 * have_relevant_joinclause(), it is not necessary that the EC be able
 		 * to form a joinclause relating exactly the two given rels, only that
@@ -3222,14 +3229,13 @@ have_relevant_eclass_joinclause(PlannerInfo *root,
 bool
 has_relevant_eclass_joinclause(PlannerInfo *root, RelOptInfo *rel1)
 {
-	Bitmapset  *matched_ecs;
 	int			i;
 
-	/* Examine only eclasses mentioning rel1 */
-	matched_ecs = get_eclass_indexes_for_relids(root, rel1->relids);
+	Assert(root->ec_merging_done);
 
+	/* Examine only eclasses mentioning rel1 */
 	i = -1;
-	while ((i = bms_next_member(matched_ecs, i)) >= 0)
+	while ((i = bms_next_member(rel1->eclass_indexes, i)) >= 0)
 	{
 		EquivalenceClass *ec = (EquivalenceClass *) list_nth(root->eq_classes,
 															 i);
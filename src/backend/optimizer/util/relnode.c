@@ -736,7 +736,9 @@ build_join_rel(PlannerInfo *root,
 	joinrel->pages = 0;
 	joinrel->tuples = 0;
 	joinrel->allvisfrac = 0;
-	joinrel->eclass_indexes = NULL;
+	/* a join mentions every EC that either of its inputs mentions */
+	joinrel->eclass_indexes = bms_union(outer_rel->eclass_indexes,
+										inner_rel->eclass_indexes);
 	joinrel->subroot = NULL;
 	joinrel->subplan_params = NIL;
 	joinrel->rel_parallel_workers = -1;
@@ -924,7 +926,9 @@ build_child_join_rel(PlannerInfo *root, RelOptInfo *outer_rel,
 	joinrel->pages = 0;
 	joinrel->tuples = 0;
 	joinrel->allvisfrac = 0;
-	joinrel->eclass_indexes = NULL;
+	/* a join mentions every EC that either of its inputs mentions */
+	joinrel->eclass_indexes = bms_union(outer_rel->eclass_indexes,
+										inner_rel->eclass_indexes);
 	joinrel->subroot = NULL;
 	joinrel->subplan_params = NIL;
 	joinrel->amflags = 0;
@@ -38,6 +38,7 @@
 #include "utils/partcache.h"
 #include "utils/ruleutils.h"
 #include "utils/snapmgr.h"
+#include "utils/sortsupport.h"
 #include "utils/syscache.h"
 
 /*
@@ -3543,19 +3544,37 @@ partition_rbound_cmp(int partnatts, FmgrInfo *partsupfunc,
 }
 
 /*
- * partition_rbound_datum_cmp
- *
- * Return whether range bound (specified in rb_datums and rb_kind)
- * is <, =, or > partition key of tuple (tuple_datums)
+ * partition_bound_datum_cmp_internal
  *
- * n_tuple_datums, partsupfunc and partcollation give number of attributes in
- * the bounds to be compared, comparison function to be used and the collations
- * of attributes resp.
+ * Compare two datums of partition key column 'keyno', using either the
+ * column's SortSupport (if ssup isn't NULL) or its support function.
  */
-int32
-partition_rbound_datum_cmp(FmgrInfo *partsupfunc, Oid *partcollation,
-						   Datum *rb_datums, PartitionRangeDatumKind *rb_kind,
-						   Datum *tuple_datums, int n_tuple_datums)
+static inline int32
+partition_bound_datum_cmp_internal(FmgrInfo *partsupfunc, Oid *partcollation,
+								   SortSupport ssup, int keyno,
+								   Datum bound_datum, Datum datum)
+{
+	if (ssup != NULL)
+		return ApplySortComparator(bound_datum, false, datum, false,
+								   &ssup[keyno]);
+
+	return DatumGetInt32(FunctionCall2Coll(&partsupfunc[keyno],
+										   partcollation[keyno],
+										   bound_datum,
+										   datum));
+}
+
+/*
+ * partition_rbound_datum_cmp_internal
+ *		Workhorse for partition_rbound_datum_cmp() and
+ *		partition_rbound_datum_cmp_ssup()
+ */
+static inline int32
+partition_rbound_datum_cmp_internal(FmgrInfo *partsupfunc, Oid *partcollation,
+									SortSupport ssup,
+									Datum *rb_datums,
+									PartitionRangeDatumKind *rb_kind,
+									Datum *tuple_datums, int n_tuple_datums)
 {
 	int			i;
 	int32		cmpval = -1;
@@ -3567,10 +3586,10 @@ partition_rbound_datum_cmp(FmgrInfo *partsupfunc, Oid *partcollation,
 		else if (rb_kind[i] == PARTITION_RANGE_DATUM_MAXVALUE)
 			return 1;
 
-		cmpval = DatumGetInt32(FunctionCall2Coll(&partsupfunc[i],
-												 partcollation[i],
-												 rb_datums[i],
-												 tuple_datums[i]));
+		cmpval = partition_bound_datum_cmp_internal(partsupfunc,
+													partcollation, ssup, i,
+													rb_datums[i],
+													tuple_datums[i]);
 		if (cmpval != 0)
 			break;
 	}
@@ -3578,6 +3597,41 @@ partition_rbound_datum_cmp(FmgrInfo *partsupfunc, Oid *partcollation,
 	return cmpval;
 }
 
+/*
+ * partition_rbound_datum_cmp
+ *
+ * Return whether range bound (specified in rb_datums and rb_kind)
+ * is <, =, or > partition key of tuple (tuple_datums)
+ *
+ * n_tuple_datums, partsupfunc and partcollation give number of attributes in
+ * the bounds to be compared, comparison function to be used and the collations
+ * of attributes resp.
+ */
+int32
+partition_rbound_datum_cmp(FmgrInfo *partsupfunc, Oid *partcollation,
+						   Datum *rb_datums, PartitionRangeDatumKind *rb_kind,
+						   Datum *tuple_datums, int n_tuple_datums)
+{
+	return partition_rbound_datum_cmp_internal(partsupfunc, partcollation,
+											   NULL, rb_datums, rb_kind,
+											   tuple_datums, n_tuple_datums);
+}
+
+/*
+ * partition_rbound_datum_cmp_ssup
+ *		Like partition_rbound_datum_cmp(), but comparing using an array of
+ *		SortSupport objects, one per partition key column.
+ */
+int32
+partition_rbound_datum_cmp_ssup(SortSupport ssup,
+								Datum *rb_datums, PartitionRangeDatumKind *rb_kind,
+								Datum *tuple_datums, int n_tuple_datums)
+{
+	return partition_rbound_datum_cmp_internal(NULL, NULL, ssup,
+											   rb_datums, rb_kind,
+											   tuple_datums, n_tuple_datums);
+}
+
 /*
  * partition_hbound_cmp
  *
@@ -3596,17 +3650,15 @@ partition_hbound_cmp(int modulus1, int remainder1, int modulus2, int remainder2)
 }
 
 /*
- * partition_list_bsearch
- *		Returns the index of the greatest bound datum that is less than equal
- * 		to the given value or -1 if all of the bound datums are greater
- *
- * *is_equal is set to true if the bound datum at the returned index is equal
- * to the input value.
+ * partition_list_bsearch_internal
+ *		Workhorse for partition_list_bsearch() and
+ *		partition_list_bsearch_ssup()
  */
-int
-partition_list_bsearch(FmgrInfo *partsupfunc, Oid *partcollation,
-					   PartitionBoundInfo boundinfo,
-					   Datum value, bool *is_equal)
+static inline int
+partition_list_bsearch_internal(FmgrInfo *partsupfunc, Oid *partcollation,
+								SortSupport ssup,
+								PartitionBoundInfo boundinfo,
+								Datum value, bool *is_equal)
 {
 	int			lo,
 				hi,
@@ -3619,10 +3671,10 @@ partition_list_bsearch(FmgrInfo *partsupfunc, Oid *partcollation,
 		int32		cmpval;
 
 		mid = (lo + hi + 1) / 2;
-		cmpval = DatumGetInt32(FunctionCall2Coll(&partsupfunc[0],
-												 partcollation[0],
-												 boundinfo->datums[mid][0],
-												 value));
+		cmpval = partition_bound_datum_cmp_internal(partsupfunc,
+													partcollation, ssup, 0,
+													boundinfo->datums[mid][0],
+													value);
 		if (cmpval <= 0)
 		{
 			lo = mid;
@@ -3637,6 +3689,36 @@ partition_list_bsearch(FmgrInfo *partsupfunc, Oid *partcollation,
 	return lo;
 }
 
+/*
+ * partition_list_bsearch
+ *		Returns the index of the greatest bound datum that is less than equal
+ * 		to the given value or -1 if all of the bound datums are greater
+ *
+ * *is_equal is set to true if the bound datum at the returned index is equal
+ * to the input value.
+ */
+int
+partition_list_bsearch(FmgrInfo *partsupfunc, Oid *partcollation,
+					   PartitionBoundInfo boundinfo,
+					   Datum value, bool *is_equal)
+{
+	return partition_list_bsearch_internal(partsupfunc, partcollation, NULL,
+										   boundinfo, value, is_equal);
+}
+
+/*
+ * partition_list_bsearch_ssup
+ *		Like partition_list_bsearch(), but comparing using the SortSupport
+ *		object of the partition key column.
+ */
+int
+partition_list_bsearch_ssup(SortSupport ssup, PartitionBoundInfo boundinfo,
+							Datum value, bool *is_equal)
+{
+	return partition_list_bsearch_internal(NULL, NULL, ssup,
+										   boundinfo, value, is_equal);
+}
+
 /*
  * partition_range_bsearch
  *		Returns the index of the greatest range bound that is less than or
@@ -3684,17 +3766,17 @@ partition_range_bsearch(int partnatts, FmgrInfo *partsupfunc,
 }
 
 /*
- * partition_range_datum_bsearch
- *		Returns the index of the greatest range bound that is less than or
- *		equal to the given tuple or -1 if all of the range bounds are greater
- *
- * *is_equal is set to true if the range bound at the returned index is equal
- * to the input tuple.
+ * partition_range_datum_bsearch_internal
+ *		Workhorse for partition_range_datum_bsearch() and
+ *		partition_range_datum_bsearch_ssup()
  */
-int
-partition_range_datum_bsearch(FmgrInfo *partsupfunc, Oid *partcollation,
-							  PartitionBoundInfo boundinfo,
-							  int nvalues, Datum *values, bool *is_equal)
+static inline int
+partition_range_datum_bsearch_internal(FmgrInfo *partsupfunc,
+									   Oid *partcollation,
+									   SortSupport ssup,
+									   PartitionBoundInfo boundinfo,
+									   int nvalues, Datum *values,
+									   bool *is_equal)
 {
 	int			lo,
 				hi,
@@ -3707,12 +3789,13 @@ partition_range_datum_bsearch(FmgrInfo *partsupfunc, Oid *partcollation,
 		int32		cmpval;
 
 		mid = (lo + hi + 1) / 2;
-		cmpval = partition_rbound_datum_cmp(partsupfunc,
-											partcollation,
-											boundinfo->datums[mid],
-											boundinfo->kind[mid],
-											values,
-											nvalues);
+		cmpval = partition_rbound_datum_cmp_internal(partsupfunc,
+													 partcollation,
+													 ssup,
+													 boundinfo->datums[mid],
+													 boundinfo->kind[mid],
+													 values,
+													 nvalues);
 		if (cmpval <= 0)
 		{
 			lo = mid;
@@ -3728,6 +3811,39 @@ partition_range_datum_bsearch(FmgrInfo *partsupfunc, Oid *partcollation,
 	return lo;
 }
 
+/*
+ * partition_range_datum_bsearch
+ *		Returns the index of the greatest range bound that is less than or
+ *		equal to the given tuple or -1 if all of the range bounds are greater
+ *
+ * *is_equal is set to true if the range bound at the returned index is equal
+ * to the input tuple.
+ */
+int
+partition_range_datum_bsearch(FmgrInfo *partsupfunc, Oid *partcollation,
+							  PartitionBoundInfo boundinfo,
+							  int nvalues, Datum *values, bool *is_equal)
+{
+	return partition_range_datum_bsearch_internal(partsupfunc, partcollation,
+												  NULL, boundinfo,
+												  nvalues, values, is_equal);
+}
+
+/*
+ * partition_range_datum_bsearch_ssup
+ *		Like partition_range_datum_bsearch(), but comparing using an array of
+ *		SortSupport objects, one per partition key column.
+ */
+int
+partition_range_datum_bsearch_ssup(SortSupport ssup,
+								   PartitionBoundInfo boundinfo,
+								   int nvalues, Datum *values, bool *is_equal)
+{
+	return partition_range_datum_bsearch_internal(NULL, NULL, ssup,
+												  boundinfo,
+												  nvalues, values, is_equal);
+}
+
 /*
  * partition_hash_bsearch
  *		Returns the index of the greatest (modulus, remainder) pair that is
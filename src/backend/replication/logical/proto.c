@@ -17,7 +17,10 @@
 #include "catalog/pg_type.h"
 #include "libpq/pqformat.h"
 #include "replication/logicalproto.h"
+#include "utils/hsearch.h"
+#include "utils/inval.h"
 #include "utils/lsyscache.h"
+#include "utils/memutils.h"
 #include "utils/syscache.h"
 
 /*
@@ -29,6 +32,24 @@
 #define TRUNCATE_CASCADE		(1<<0)
 #define TRUNCATE_RESTART_SEQS	(1<<1)
 
+/*
+ * Cache of the output and send functions of the types of published columns,
+ * so that logicalrep_write_tuple() doesn't have to look them up for every
+ * column of every row.  Entries are invalidated by pg_type changes.
+ */
+typedef struct LogicalRepTypeOutEntry
+{
+	Oid			typid;			/* hash key */
+	uint32		hashvalue;		/* hash value of typid in the type syscache */
+	bool		valid;
+	bool		has_send;		/* does the type have a send function? */
+	MemoryContext fcontext;		/* holds the functions' fn_extra state */
+	FmgrInfo	output_finfo;
+	FmgrInfo	send_finfo;
+} LogicalRepTypeOutEntry;
+
+static HTAB *LogicalRepTypeOutCache = NULL;
+
 static void logicalrep_write_attrs(StringInfo out, Relation rel,
 								   Bitmapset *columns,
 								   PublishGencolsType include_gencols_type);
@@ -37,6 +58,7 @@ static void logicalrep_write_tuple(StringInfo out, Relation rel,
 								   bool binary, Bitmapset *columns,
 								   PublishGencolsType include_gencols_type);
 static void logicalrep_read_attrs(StringInfo in, LogicalRepRelation *rel);
+static LogicalRepTypeOutEntry *logicalrep_get_type_output(Oid typid);
 static void logicalrep_read_tuple(StringInfo in, LogicalRepTupleData *tuple);
 
 static void logicalrep_write_namespace(StringInfo out, Oid nspid);
@@ -795,8 +817,7 @@ logicalrep_write_tuple(StringInfo out, Relation rel, TupleTableSlot *slot,
 	/* Write the values */
 	for (i = 0; i < desc->natts; i++)
 	{
-		HeapTuple	typtup;
-		Form_pg_type typclass;
+		LogicalRepTypeOutEntry *typentry;
 		Form_pg_attribute att = TupleDescAttr(desc, i);
 
 		if (!logicalrep_should_publish_column(att, columns,
@@ -820,21 +841,18 @@ logicalrep_write_tuple(StringInfo out, Relation rel, TupleTableSlot *slot,
 			continue;
 		}
 
-		typtup = SearchSysCache1(TYPEOID, ObjectIdGetDatum(att->atttypid));
-		if (!HeapTupleIsValid(typtup))
-			elog(ERROR, "cache lookup failed for type %u", att->atttypid);
-		typclass = (Form_pg_type) GETSTRUCT(typtup);
+		typentry = logicalrep_get_type_output(att->atttypid);
 
 		/*
 		 * Send in binary if requested and type has suitable send function.
 		 */
-		if (binary && OidIsValid(typclass->typsend))
+		if (binary && typentry->has_send)
 		{
 			bytea	   *outputbytes;
 			int			len;
 
 			pq_sendbyte(out, LOGICALREP_COLUMN_BINARY);
-			outputbytes = OidSendFunctionCall(typclass->typsend, values[i]);
+			outputbytes = SendFunctionCall(&typentry->send_finfo, values[i]);
 			len = VARSIZE(outputbytes) - VARHDRSZ;
 			pq_sendint(out, len, 4);	/* length */
 			pq_sendbytes(out, VARDATA(outputbytes), len);	/* data */
@@ -845,13 +863,98 @@ logicalrep_write_tuple(StringInfo out, Relation rel, TupleTableSlot *slot,
 			char	   *outputstr;
 
 			pq_sendbyte(out, LOGICALREP_COLUMN_TEXT);
-			outputstr = OidOutputFunctionCall(typclass->typoutput, values[i]);
+			outputstr = OutputFunctionCall(&typentry->output_finfo, values[i]);
 			pq_sendcountedtext(out, outputstr, strlen(outputstr));
 			pfree(outputstr);
 		}
+	}
+}
+
+/*
+ * Invalidation callback for the type output cache.
+ */
+static void
+logicalrep_type_out_invalidate(Datum arg, int cacheid, uint32 hashvalue)
+{
+	HASH_SEQ_STATUS status;
+	LogicalRepTypeOutEntry *entry;
+
+	hash_seq_init(&status, LogicalRepTypeOutCache);
+	while ((entry = (LogicalRepTypeOutEntry *) hash_seq_search(&status)) != NULL)
+	{
+		if (hashvalue == 0 || entry->hashvalue == hashvalue)
+			entry->valid = false;
+	}
+}
+
+/*
+ * Get the cached output and send functions of the given type.
+ */
+static LogicalRepTypeOutEntry *
+logicalrep_get_type_output(Oid typid)
+{
+	LogicalRepTypeOutEntry *entry;
+	bool		found;
+
+	if (LogicalRepTypeOutCache == NULL)
+	{
+		HASHCTL		ctl;
+
+		ctl.keysize = sizeof(Oid);
+		ctl.entrysize = sizeof(LogicalRepTypeOutEntry);
+		ctl.hcxt = CacheMemoryContext;
+		LogicalRepTypeOutCache = hash_create("logical replication type output cache",
+											 64, &ctl,
+											 HASH_ELEM | HASH_BLOBS | HASH_CONTEXT);
+
+		CacheRegisterSyscacheCallback(TYPEOID,
+									  logicalrep_type_out_invalidate,
+									  (Datum) 0);
+	}
+
+	entry = (LogicalRepTypeOutEntry *) hash_search(LogicalRepTypeOutCache,
+												   &typid, HASH_ENTER, &found);
+	if (!found)
+	{
+		entry->valid = false;
+		entry->fcontext = NULL;
+	}
+
+	if (!entry->valid)
+	{
+		HeapTuple	typtup;
+		Form_pg_type typclass;
+
+		typtup = SearchSysCache1(TYPEOID, ObjectIdGetDatum(typid));
+		if (!HeapTupleIsValid(typtup))
+			elog(ERROR, "cache lookup failed for type %u", typid);
+		typclass = (Form_pg_type) GETSTRUCT(typtup);
+
+		/*
+		 * Throw away whatever state the previous incarnation of the functions
+		 * kept in fn_extra.
+		 */
+		if (entry->fcontext == NULL)
+			entry->fcontext = AllocSetContextCreate(CacheMemoryContext,
+													"logical replication type output",
+													ALLOCSET_SMALL_SIZES);
+		else
+			MemoryContextReset(entry->fcontext);
+
+		entry->hashvalue = GetSysCacheHashValue1(TYPEOID,
+												 ObjectIdGetDatum(typid));
+		fmgr_info_cxt(typclass->typoutput, &entry->output_finfo,
+					  entry->fcontext);
+		entry->has_send = OidIsValid(typclass->typsend);
+		if (entry->has_send)
+			fmgr_info_cxt(typclass->typsend, &entry->send_finfo,
+						  entry->fcontext);
+		entry->valid = true;
 
 		ReleaseSysCache(typtup);
 	}
+
+	return entry;
 }
 
 /*
@@ -213,6 +213,9 @@ typedef struct ReorderBufferDiskChange
 int			logical_decoding_work_mem;
 static const Size max_changes_in_memory = 4096; /* XXX for restore only */
 
+/* size of the buffer used to batch writes to spill files */
+#define REORDER_BUFFER_SPILL_BUFSIZE (64 * 1024)
+
 /* GUC variable */
 int			debug_logical_replication_streaming = DEBUG_LOGICAL_REP_STREAMING_BUFFERED;
 
@@ -254,6 +257,10 @@ static void ReorderBufferCheckMemoryLimit(ReorderBuffer *rb);
 static void ReorderBufferSerializeTXN(ReorderBuffer *rb, ReorderBufferTXN *txn);
 static void ReorderBufferSerializeChange(ReorderBuffer *rb, ReorderBufferTXN *txn,
 										 int fd, ReorderBufferChange *change);
+static void ReorderBufferSerializeWrite(ReorderBufferTXN *txn, int fd,
+										char *data, Size len);
+static void ReorderBufferSerializeFlush(ReorderBuffer *rb, ReorderBufferTXN *txn,
+										int fd);
 static Size ReorderBufferRestoreChanges(ReorderBuffer *rb, ReorderBufferTXN *txn,
 										TXNEntryFile *file, XLogSegNo *segno);
 static void ReorderBufferRestoreChange(ReorderBuffer *rb, ReorderBufferTXN *txn,
@@ -367,6 +374,8 @@ ReorderBufferAllocate(void)
 
 	buffer->outbuf = NULL;
 	buffer->outbufsize = 0;
+	buffer->spillbuf = NULL;
+	buffer->spillbuflen = 0;
 	buffer->size = 0;
 
 	/* txn_heap is ordered by transaction size */
@@ -3842,6 +3851,9 @@ ReorderBufferSerializeTXN(ReorderBuffer *rb, ReorderBufferTXN *txn)
 	elog(DEBUG2, "spill %u changes in XID %u to disk",
 		 (uint32) txn->nentries_mem, txn->xid);
 
+	/* Forget anything left in the write buffer by an earlier error. */
+	rb->spillbuflen = 0;
+
 	/* do the same to all child TXs */
 	dlist_foreach(subtxn_i, &txn->subtxns)
 	{
@@ -3868,7 +3880,10 @@ ReorderBufferSerializeTXN(ReorderBuffer *rb, ReorderBufferTXN *txn)
 			char		path[MAXPGPATH];
 
 			if (fd != -1)
+			{
+				ReorderBufferSerializeFlush(rb, txn, fd);
 				CloseTransientFile(fd);
+			}
 
 			XLByteToSeg(change->lsn, curOpenSegNo, wal_segment_size);
 
@@ -3918,7 +3933,10 @@ ReorderBufferSerializeTXN(ReorderBuffer *rb, ReorderBufferTXN *txn)
 	txn->txn_flags |= RBTXN_IS_SERIALIZED;
 
 	if (fd != -1)
+	{
+		ReorderBufferSerializeFlush(rb, txn, fd);
 		CloseTransientFile(fd);
+	}
 }
 
 /*
@@ -4107,9 +4125,49 @@ ReorderBufferSerializeChange(ReorderBuffer *rb, ReorderBufferTXN *txn,
 
 	ondisk->size = sz;
 
+	/*
+	 * Rather than issuing a write() per change, collect the serialized
+	 * changes in a buffer and write it out when it fills up, or when the
+	 * caller is done with the file.  Changes that don't fit into the buffer
+	 * at all are written directly.
+	 */
+	if (rb->spillbuflen + sz > REORDER_BUFFER_SPILL_BUFSIZE)
+		ReorderBufferSerializeFlush(rb, txn, fd);
+
+	if (sz > REORDER_BUFFER_SPILL_BUFSIZE)
+		ReorderBufferSerializeWrite(txn, fd, rb->outbuf, sz);
+	else
+	{
+		if (rb->spillbuf == NULL)
+			rb->spillbuf = MemoryContextAlloc(rb->context,
+											  REORDER_BUFFER_SPILL_BUFSIZE);
+		memcpy(rb->spillbuf + rb->spillbuflen, rb->outbuf, sz);
+		rb->spillbuflen += sz;
+	}
+
+	/*
+	 * Keep the transaction's final_lsn up to date with each change we send to
+	 * disk, so that ReorderBufferRestoreCleanup works correctly.  (We used to
+	 * only do this on commit and abort records, but that doesn't work if a
+	 * system crash leaves a transaction without its abort record).
+	 *
+	 * Make sure not to move it backwards.
+	 */
+	if (txn->final_lsn < change->lsn)
+		txn->final_lsn = change->lsn;
+
+	Assert(ondisk->change.action == change->action);
+}
+
+/*
+ * Write data to a spill file, erroring out on failure.
+ */
+static void
+ReorderBufferSerializeWrite(ReorderBufferTXN *txn, int fd, char *data, Size len)
+{
 	errno = 0;
 	pgstat_report_wait_start(WAIT_EVENT_REORDER_BUFFER_WRITE);
-	if (write(fd, rb->outbuf, ondisk->size) != ondisk->size)
+	if (write(fd, data, len) != len)
 	{
 		int			save_errno = errno;
 
@@ -4123,19 +4181,21 @@ ReorderBufferSerializeChange(ReorderBuffer *rb, ReorderBufferTXN *txn,
 						txn->xid)));
 	}
 	pgstat_report_wait_end();
+}
 
-	/*
-	 * Keep the transaction's final_lsn up to date with each change we send to
-	 * disk, so that ReorderBufferRestoreCleanup works correctly.  (We used to
-	 * only do this on commit and abort records, but that doesn't work if a
-	 * system crash leaves a transaction without its abort record).
-	 *
-	 * Make sure not to move it backwards.
-	 */
-	if (txn->final_lsn < change->lsn)
-		txn->final_lsn = change->lsn;
+/*
+ * Write out the changes collected by ReorderBufferSerializeChange().
+ *
+ * Must be called before the file is closed.
+ */
+static void
+ReorderBufferSerializeFlush(ReorderBuffer *rb, ReorderBufferTXN *txn, int fd)
+{
+	if (rb->spillbuflen == 0)
+		return;
 
-	Assert(ondisk->change.action == change->action);
+	ReorderBufferSerializeWrite(txn, fd, rb->spillbuf, rb->spillbuflen);
+	rb->spillbuflen = 0;
 }
 
 /* Returns true, if the output plugin supports streaming, false, otherwise. */
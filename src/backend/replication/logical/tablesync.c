@@ -135,6 +135,7 @@ static List *table_states_not_ready = NIL;
 static bool FetchTableStates(bool *started_tx);
 
 static StringInfo copybuf = NULL;
+static bool copy_eof = false;
 
 /*
  * Exit routine for synchronization worker.
@@ -712,6 +713,11 @@ make_copy_attnamelist(LogicalRepRelMapEntry *rel)
 /*
  * Data source callback for the COPY FROM, which reads from the remote
  * connection and passes the data back to our local COPY.
+ *
+ * The publisher sends one CopyData message per row, so rather than returning
+ * as soon as minread bytes are available, we keep filling the caller's buffer
+ * for as long as more messages can be read without waiting.  That lets COPY
+ * process the data in large chunks instead of one row per callback.
  */
 static int
 copy_read_data(void *outbuf, int minread, int maxread)
@@ -726,12 +732,13 @@ copy_read_data(void *outbuf, int minread, int maxread)
 		if (avail > maxread)
 			avail = maxread;
 		memcpy(outbuf, &copybuf->data[copybuf->cursor], avail);
+		outbuf = (char *) outbuf + avail;
 		copybuf->cursor += avail;
 		maxread -= avail;
 		bytesread += avail;
 	}
 
-	while (maxread > 0 && bytesread < minread)
+	while (maxread > 0 && !copy_eof)
 	{
 		pgsocket	fd = PGINVALID_SOCKET;
 		int			len;
@@ -747,7 +754,11 @@ copy_read_data(void *outbuf, int minread, int maxread)
 			if (len == 0)
 				break;
 			else if (len < 0)
+			{
+				/* Remember not to read from the connection again. */
+				copy_eof = true;
 				return bytesread;
+			}
 			else
 			{
 				/* Process the data */
@@ -765,10 +776,14 @@ copy_read_data(void *outbuf, int minread, int maxread)
 				bytesread += avail;
 			}
 
-			if (maxread <= 0 || bytesread >= minread)
+			if (maxread <= 0)
 				return bytesread;
 		}
 
+		/* Nothing more to read right now; return what we have, if enough. */
+		if (bytesread >= minread)
+			break;
+
 		/*
 		 * Wait for more data or latch.
 		 */
@@ -1238,6 +1253,7 @@ copy_table(Relation rel)
 	walrcv_clear_result(res);
 
 	copybuf = makeStringInfo();
+	copy_eof = false;
 
 	pstate = make_parsestate(NULL);
 	(void) addRangeTableEntryForRelation(pstate, rel, AccessShareLock,
@@ -3545,6 +3545,18 @@ store_flush_position(XLogRecPtr remote_lsn, XLogRecPtr local_lsn)
 	if (am_parallel_apply_worker())
 		return;
 
+	/*
+	 * If nothing is queued ahead of this position and the local WAL for it is
+	 * already flushed (always true for an invalid local_lsn, and the common
+	 * case with synchronous_commit enabled), get_flush_position() would just
+	 * remove the entry again and report the received position instead, so
+	 * don't bother tracking it.  This saves a palloc/pfree cycle and a list
+	 * walk per applied transaction.
+	 */
+	if (dlist_is_empty(&lsn_mapping) &&
+		(XLogRecPtrIsInvalid(local_lsn) || local_lsn <= GetFlushRecPtr(NULL)))
+		return;
+
 	/* Need to do this in permanent context */
 	MemoryContextSwitchTo(ApplyContext);
 
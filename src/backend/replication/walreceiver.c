@@ -101,6 +101,21 @@ static int	recvFile = -1;
 static TimeLineID recvFileTLI = 0;
 static XLogSegNo recvSegNo = 0;
 
+/*
+ * WAL data received from the primary is collected in this buffer, so that
+ * consecutive WAL data messages can be written out with a single write()
+ * call.  writeBufStart is the WAL position of the first buffered byte, and
+ * writeBufTLI its timeline.  The buffer is emptied by XLogWalRcvWriteBuffered()
+ * whenever the walreceiver has processed all the data that's available, and
+ * before anything is flushed.
+ */
+#define WALRCV_WRITE_BUFFER_SIZE	(XLOG_BLCKSZ * 64)
+
+static char *writeBuf = NULL;
+static Size writeBufLen = 0;
+static XLogRecPtr writeBufStart = InvalidXLogRecPtr;
+static TimeLineID writeBufTLI = 0;
+
 /*
  * LogstreamResult indicates the byte positions that we have already
  * written/fsynced.
@@ -138,6 +153,9 @@ static void XLogWalRcvProcessMsg(unsigned char type, char *buf, Size len,
 								 TimeLineID tli);
 static void XLogWalRcvWrite(char *buf, Size nbytes, XLogRecPtr recptr,
 							TimeLineID tli);
+static void XLogWalRcvBufferWrite(char *buf, Size nbytes, XLogRecPtr recptr,
+								  TimeLineID tli);
+static void XLogWalRcvWriteBuffered(void);
 static void XLogWalRcvFlush(bool dying, TimeLineID tli);
 static void XLogWalRcvClose(XLogRecPtr recptr, TimeLineID tli);
 static void XLogWalRcvSendReply(bool force, bool requestReply);
@@ -499,6 +517,7 @@ WalReceiverMain(const void *startup_data, size_t startup_data_len)
 							break;
 						else if (len < 0)
 						{
+							XLogWalRcvWriteBuffered();
 							ereport(LOG,
 									(errmsg("replication terminated by primary server"),
 									 errdetail("End of WAL reached on timeline %u at %X/%X.",
@@ -510,6 +529,9 @@ WalReceiverMain(const void *startup_data, size_t startup_data_len)
 						len = walrcv_receive(wrconn, &buf, &wait_fd);
 					}
 
+					/* Write out any WAL data we have collected. */
+					XLogWalRcvWriteBuffered();
+
 					/* Let the primary know that we received some data. */
 					XLogWalRcvSendReply(false, false);
 
@@ -878,7 +900,7 @@ XLogWalRcvProcessMsg(unsigned char type, char *buf, Size len, TimeLineID tli)
 
 				buf += hdrlen;
 				len -= hdrlen;
-				XLogWalRcvWrite(buf, len, dataStart, tli);
+				XLogWalRcvBufferWrite(buf, len, dataStart, tli);
 				break;
 			}
 		case 'k':				/* Keepalive */
@@ -1006,6 +1028,57 @@ XLogWalRcvWrite(char *buf, Size nbytes, XLogRecPtr recptr, TimeLineID tli)
 		XLogWalRcvClose(recptr, tli);
 }
 
+/*
+ * Add received WAL data to the write buffer, writing out the buffer first if
+ * the new data doesn't fit or doesn't directly follow the buffered data.
+ */
+static void
+XLogWalRcvBufferWrite(char *buf, Size nbytes, XLogRecPtr recptr, TimeLineID tli)
+{
+	if (writeBufLen > 0 &&
+		(recptr != writeBufStart + writeBufLen || tli != writeBufTLI ||
+		 writeBufLen + nbytes > WALRCV_WRITE_BUFFER_SIZE))
+		XLogWalRcvWriteBuffered();
+
+	/* Data that is too big to buffer is written out directly. */
+	if (nbytes >= WALRCV_WRITE_BUFFER_SIZE)
+	{
+		XLogWalRcvWrite(buf, nbytes, recptr, tli);
+		return;
+	}
+
+	if (writeBuf == NULL)
+		writeBuf = MemoryContextAlloc(TopMemoryContext,
+									  WALRCV_WRITE_BUFFER_SIZE);
+
+	if (writeBufLen == 0)
+	{
+		writeBufStart = recptr;
+		writeBufTLI = tli;
+	}
+	memcpy(writeBuf + writeBufLen, buf, nbytes);
+	writeBufLen += nbytes;
+}
+
+/*
+ * Write out the WAL data collected by XLogWalRcvBufferWrite(), if any.
+ */
+static void
+XLogWalRcvWriteBuffered(void)
+{
+	Size		nbytes = writeBufLen;
+
+	if (nbytes == 0)
+		return;
+
+	/*
+	 * Reset the buffer before writing, since XLogWalRcvWrite() can recurse
+	 * into XLogWalRcvFlush() when it switches to a new segment.
+	 */
+	writeBufLen = 0;
+	XLogWalRcvWrite(writeBuf, nbytes, writeBufStart, writeBufTLI);
+}
+
 /*
  * Flush the log to disk.
  *
@@ -1017,6 +1090,16 @@ XLogWalRcvFlush(bool dying, TimeLineID tli)
 {
 	Assert(tli != 0);
 
+	/*
+	 * Make sure everything we have received has been written.  If we're
+	 * dying, just forget about the buffered data instead; it hasn't been
+	 * reported as written, so it will be streamed again.
+	 */
+	if (dying)
+		writeBufLen = 0;
+	else
+		XLogWalRcvWriteBuffered();
+
 	if (LogstreamResult.Flush < LogstreamResult.Write)
 	{
 		WalRcvData *walrcv = WalRcv;
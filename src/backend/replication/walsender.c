@@ -1025,6 +1025,7 @@ logical_read_xlog_page(XLogReaderState *state, XLogRecPtr targetPagePtr, int req
 {
 	XLogRecPtr	flushptr;
 	int			count;
+	Size		rbytes;
 	WALReadError errinfo;
 	XLogSegNo	segno;
 	TimeLineID	currTLI;
@@ -1065,11 +1066,21 @@ logical_read_xlog_page(XLogReaderState *state, XLogRecPtr targetPagePtr, int req
 	else
 		count = flushptr - targetPagePtr;	/* part of the page available */
 
-	/* now actually read the data, we know it's there */
-	if (!WALRead(state,
-				 cur_page,
-				 targetPagePtr,
-				 count,
+	/*
+	 * Now actually read the data, we know it's there.  Recently generated WAL
+	 * is usually still in the WAL buffers, so try those first; this saves a
+	 * read() per page for walsenders that are keeping up, which adds up when
+	 * many logical slots are decoding the same WAL.
+	 */
+	rbytes = WALReadFromBuffers(cur_page, targetPagePtr, count,
+								state->currTLI);
+
+	/* read the remaining WAL from WAL file */
+	if (rbytes < count &&
+		!WALRead(state,
+				 cur_page + rbytes,
+				 targetPagePtr + rbytes,
+				 count - rbytes,
 				 currTLI,		/* Pass the current TLI because only
 								 * WalSndSegmentOpen controls whether new TLI
 								 * is needed. */
@@ -67,6 +67,13 @@
 
 #define UINT32_ACCESS_ONCE(var)		 ((uint32)(*((volatile uint32 *)&(var))))
 
+/*
+ * Number of ProcGlobal->xids entries that GetSnapshotData() checks at once
+ * when skipping over backends that don't have an XID assigned.  Must be a
+ * power of 2.
+ */
+#define SNAPSHOT_XID_BLOCK_SIZE 16
+
 /* Our shared memory area */
 typedef struct ProcArrayStruct
 {
@@ -368,6 +375,7 @@ static void MaintainLatestCompletedXidRecovery(TransactionId latestXid);
 static inline FullTransactionId FullXidRelativeTo(FullTransactionId rel,
 												  TransactionId xid);
 static void GlobalVisUpdateApply(ComputeXidHorizonsResult *horizons);
+static inline bool XidBlockHasAssigned(const TransactionId *xids);
 
 /*
  * Report shared-memory space needed by ProcArrayShmemInit
@@ -2082,6 +2090,27 @@ GetMaxSnapshotSubxidCount(void)
 	return TOTAL_MAX_CACHED_SUBXIDS;
 }
 
+/*
+ * Helper function for GetSnapshotData() that checks whether any of the
+ * SNAPSHOT_XID_BLOCK_SIZE entries starting at xids is a valid XID.
+ *
+ * This is written as a plain OR over a fixed number of elements so that the
+ * compiler can vectorize it.  The entries may be concurrently set by
+ * GetNewTransactionId(), but any XID assigned that way follows the
+ * snapshot's xmax and would be skipped anyway, so there is no need to read
+ * them with UINT32_ACCESS_ONCE.
+ */
+static inline bool
+XidBlockHasAssigned(const TransactionId *xids)
+{
+	TransactionId any = InvalidTransactionId;
+
+	for (int i = 0; i < SNAPSHOT_XID_BLOCK_SIZE; i++)
+		any |= xids[i];
+
+	return any != InvalidTransactionId;
+}
+
 /*
  * Helper function for GetSnapshotData() that checks if the bulk of the
  * visibility information in the snapshot is still valid. If so, it updates
@@ -2272,10 +2301,25 @@ GetSnapshotData(Snapshot snapshot)
 		 */
 		for (int pgxactoff = 0; pgxactoff < numProcs; pgxactoff++)
 		{
-			/* Fetch xid just once - see GetNewTransactionId */
-			TransactionId xid = UINT32_ACCESS_ONCE(other_xids[pgxactoff]);
+			TransactionId xid;
 			uint8		statusFlags;
 
+			/*
+			 * With many connections, most backends typically don't have an
+			 * XID assigned at any given moment.  Skip whole blocks of such
+			 * entries at once rather than examining them one by one.
+			 */
+			if ((pgxactoff & (SNAPSHOT_XID_BLOCK_SIZE - 1)) == 0 &&
+				pgxactoff + SNAPSHOT_XID_BLOCK_SIZE <= numProcs &&
+				!XidBlockHasAssigned(&other_xids[pgxactoff]))
+			{
+				pgxactoff += SNAPSHOT_XID_BLOCK_SIZE - 1;
+				continue;
+			}
+
+			/* Fetch xid just once - see GetNewTransactionId */
+			xid = UINT32_ACCESS_ONCE(other_xids[pgxactoff]);
+
 			Assert(allProcs[arrayP->pgprocnos[pgxactoff]].pgxactoff == pgxactoff);
 
 			/*
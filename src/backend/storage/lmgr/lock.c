@@ -210,9 +210,14 @@ int			FastPathLockGroupsPerBackend = 0;
  *
  * The selected constant (49157) is a prime not too close to 2^k, and it's
  * small enough to not cause overflows (in 64-bit).
+ *
+ * FastPathLockGroupsPerBackend is always a power of 2 (see
+ * InitializeFastPathLocks), so we can use a mask rather than a modulo, which
+ * would be a 64-bit division on every lock acquisition and release.
  */
 #define FAST_PATH_REL_GROUP(rel) \
-	(((uint64) (rel) * 49157) % FastPathLockGroupsPerBackend)
+	(AssertMacro(((FastPathLockGroupsPerBackend - 1) & FastPathLockGroupsPerBackend) == 0), \
+	 (uint32) (((uint64) (rel) * 49157) & (FastPathLockGroupsPerBackend - 1)))
 
 /*
  * Given the group/slot indexes, calculate the slot index in the whole array
@@ -274,6 +279,7 @@ int			FastPathLockGroupsPerBackend = 0;
 	(mode) > ShareUpdateExclusiveLock)
 
 static bool FastPathGrantRelationLock(Oid relid, LOCKMODE lockmode);
+static bool FastPathRelationMayHaveSlot(Oid relid);
 static bool FastPathUnGrantRelationLock(Oid relid, LOCKMODE lockmode);
 static bool FastPathTransferRelationLocks(LockMethod lockMethodTable,
 										  const LOCKTAG *locktag, uint32 hashcode);
@@ -976,12 +982,18 @@ LockAcquireExtended(const LOCKTAG *locktag,
 	 * further use of it until we release some locks.  It's possible that some
 	 * other backend has transferred some of those locks to the shared hash
 	 * table, leaving space free, but it's not worth acquiring the LWLock just
-	 * to check.  It's also possible that we're acquiring a second or third
-	 * lock type on a relation we have already locked using the fast-path, but
-	 * for now we don't worry about that case either.
+	 * to check.
+	 *
+	 * However, if we're acquiring a second or third lock type on a relation
+	 * that already occupies a fast-path slot, we can record the new mode in
+	 * that slot even when the group is full.  That's common when a query on
+	 * a partitioned table touches more partitions than fit in the fast-path
+	 * array, and saves going to the shared lock table (and contending on its
+	 * partition locks) for each of them.
 	 */
 	if (EligibleForRelationFastPath(locktag, lockmode) &&
-		FastPathLocalUseCounts[FAST_PATH_REL_GROUP(locktag->locktag_field2)] < FP_LOCK_SLOTS_PER_GROUP)
+		(FastPathLocalUseCounts[FAST_PATH_REL_GROUP(locktag->locktag_field2)] < FP_LOCK_SLOTS_PER_GROUP ||
+		 FastPathRelationMayHaveSlot(locktag->locktag_field2)))
 	{
 		uint32		fasthashcode = FastPathStrongLockHashPartition(hashcode);
 		bool		acquired;
@@ -2781,6 +2793,29 @@ FastPathGrantRelationLock(Oid relid, LOCKMODE lockmode)
 	return false;
 }
 
+/*
+ * FastPathRelationMayHaveSlot
+ *		Check whether relid occupies a slot in our own fast-path array.
+ *
+ * This is done without acquiring fpInfoLock.  That's safe, because only we
+ * ever set fpRelId entries in our own PGPROC, but another backend might be
+ * concurrently transferring our locks to the main lock table, so the result
+ * is only a hint.  FastPathGrantRelationLock rechecks under the lock.
+ */
+static bool
+FastPathRelationMayHaveSlot(Oid relid)
+{
+	uint32		group = FAST_PATH_REL_GROUP(relid);
+
+	for (uint32 i = 0; i < FP_LOCK_SLOTS_PER_GROUP; i++)
+	{
+		if (MyProc->fpRelId[FAST_PATH_SLOT(group, i)] == relid)
+			return true;
+	}
+
+	return false;
+}
+
 /*
  * FastPathUnGrantRelationLock
  *		Release fast-path lock, if present.  Update backend-private local
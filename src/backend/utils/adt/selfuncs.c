@@ -3940,6 +3940,212 @@ estimate_multivariate_bucketsize(PlannerInfo *root, RelOptInfo *inner,
 	return otherclauses;
 }
 
+/*
+ * estimate_multivariate_eqjoinsel
+ *	  Estimate the selectivity of equijoin clauses that join the same two
+ *	  base relations on several columns, using extended statistics.
+ *
+ * Multiplying together the selectivities of the individual clauses, as
+ * clauselist_selectivity() normally does, assumes that the join columns are
+ * independent, which is frequently far from the truth for multi-column join
+ * keys.  When both relations have ndistinct statistics covering all of the
+ * columns in such a group of clauses, estimate the group's selectivity the
+ * same way eqjoinsel_inner() does without MCVs, but using the number of
+ * distinct combinations of values.  Since correlation between the columns
+ * can only reduce that number, we never let the result drop below the
+ * estimate made assuming independence; that way we keep the benefit of any
+ * per-column MCV matching done by eqjoinsel().
+ *
+ * The 0-based list positions of the clauses estimated here are added to
+ * *estimatedclauses; positions already present there are skipped.  Returns
+ * the combined selectivity of the estimated clauses (1.0 if none).
+ */
+Selectivity
+estimate_multivariate_eqjoinsel(PlannerInfo *root, List *clauses,
+								JoinType jointype, SpecialJoinInfo *sjinfo,
+								Bitmapset **estimatedclauses)
+{
+	Selectivity sel = 1.0;
+	Bitmapset  *candidates = NULL;
+	ListCell   *lc;
+	int			listidx;
+
+	/* Only join types that eqjoinsel() treats like an inner join */
+	if (jointype != JOIN_INNER && jointype != JOIN_LEFT &&
+		jointype != JOIN_FULL)
+		return sel;
+
+	/*
+	 * Find mergejoinable equality clauses whose sides each reference a
+	 * single base relation that has extended statistics.
+	 */
+	listidx = -1;
+	foreach(lc, clauses)
+	{
+		Node	   *clause = (Node *) lfirst(lc);
+		RestrictInfo *rinfo;
+		int			relid1;
+		int			relid2;
+
+		listidx++;
+
+		if (bms_is_member(listidx, *estimatedclauses))
+			continue;
+		if (!IsA(clause, RestrictInfo))
+			continue;
+		rinfo = (RestrictInfo *) clause;
+		if (rinfo->pseudoconstant || rinfo->mergeopfamilies == NIL)
+			continue;
+		if (!bms_get_singleton_member(rinfo->left_relids, &relid1) ||
+			!bms_get_singleton_member(rinfo->right_relids, &relid2) ||
+			relid1 == relid2)
+			continue;
+		if (root->simple_rel_array[relid1] == NULL ||
+			root->simple_rel_array[relid1]->statlist == NIL ||
+			root->simple_rel_array[relid2] == NULL ||
+			root->simple_rel_array[relid2]->statlist == NIL)
+			continue;
+
+		candidates = bms_add_member(candidates, listidx);
+	}
+
+	/* Process the candidates in groups joining the same pair of relations */
+	while (bms_num_members(candidates) >= 2)
+	{
+		RestrictInfo *first;
+		int			relid1;
+		int			relid2;
+		RelOptInfo *rel1;
+		RelOptInfo *rel2;
+		List	   *varinfos1 = NIL;
+		List	   *varinfos2 = NIL;
+		List	   *exprs1 = NIL;
+		List	   *exprs2 = NIL;
+		Bitmapset  *group = NULL;
+		double		nd1;
+		double		nd2;
+		double		nullfrac1 = 0.0;
+		double		nullfrac2 = 0.0;
+		Selectivity mvsel;
+		Selectivity indepsel = 1.0;
+		int			i;
+
+		first = (RestrictInfo *) list_nth(clauses,
+										  bms_next_member(candidates, -1));
+		(void) bms_get_singleton_member(first->left_relids, &relid1);
+		(void) bms_get_singleton_member(first->right_relids, &relid2);
+		rel1 = root->simple_rel_array[relid1];
+		rel2 = root->simple_rel_array[relid2];
+
+		i = -1;
+		while ((i = bms_next_member(candidates, i)) >= 0)
+		{
+			RestrictInfo *rinfo = (RestrictInfo *) list_nth(clauses, i);
+			Node	   *expr1;
+			Node	   *expr2;
+			GroupVarInfo *varinfo;
+
+			if (bms_is_member(relid1, rinfo->left_relids) &&
+				bms_is_member(relid2, rinfo->right_relids))
+			{
+				expr1 = get_leftop(rinfo->clause);
+				expr2 = get_rightop(rinfo->clause);
+			}
+			else if (bms_is_member(relid2, rinfo->left_relids) &&
+					 bms_is_member(relid1, rinfo->right_relids))
+			{
+				expr1 = get_rightop(rinfo->clause);
+				expr2 = get_leftop(rinfo->clause);
+			}
+			else
+				continue;		/* joins some other pair of relations */
+
+			candidates = bms_del_member(candidates, i);
+
+			/*
+			 * Leave clauses that repeat a column on either side to the
+			 * normal estimation; ndistinct wouldn't account for them.
+			 */
+			if (list_member(exprs1, expr1) || list_member(exprs2, expr2))
+				continue;
+
+			exprs1 = lappend(exprs1, expr1);
+			exprs2 = lappend(exprs2, expr2);
+
+			varinfo = (GroupVarInfo *) palloc(sizeof(GroupVarInfo));
+			varinfo->var = expr1;
+			varinfo->rel = rel1;
+			varinfo->ndistinct = 0.0;
+			varinfo->isdefault = false;
+			varinfos1 = lappend(varinfos1, varinfo);
+
+			varinfo = (GroupVarInfo *) palloc(sizeof(GroupVarInfo));
+			varinfo->var = expr2;
+			varinfo->rel = rel2;
+			varinfo->ndistinct = 0.0;
+			varinfo->isdefault = false;
+			varinfos2 = lappend(varinfos2, varinfo);
+
+			group = bms_add_member(group, i);
+		}
+
+		if (bms_num_members(group) < 2)
+			continue;
+
+		/*
+		 * We need a single statistics object on each side that covers all of
+		 * the group's columns; anything less would leave us combining the
+		 * multivariate estimate with per-column ones, which is no better than
+		 * what clauselist_selectivity() does by itself.
+		 */
+		if (!estimate_multivariate_ndistinct(root, rel1, &varinfos1, &nd1) ||
+			varinfos1 != NIL ||
+			!estimate_multivariate_ndistinct(root, rel2, &varinfos2, &nd2) ||
+			varinfos2 != NIL)
+			continue;
+
+		/*
+		 * A row with a NULL in any of the join columns can't join.  Lacking
+		 * anything better, assume independence of the columns' null
+		 * fractions.
+		 */
+		foreach(lc, exprs1)
+		{
+			VariableStatData vardata;
+
+			examine_variable(root, (Node *) lfirst(lc), 0, &vardata);
+			if (HeapTupleIsValid(vardata.statsTuple))
+				nullfrac1 += (1.0 - nullfrac1) *
+					((Form_pg_statistic) GETSTRUCT(vardata.statsTuple))->stanullfrac;
+			ReleaseVariableStats(vardata);
+		}
+		foreach(lc, exprs2)
+		{
+			VariableStatData vardata;
+
+			examine_variable(root, (Node *) lfirst(lc), 0, &vardata);
+			if (HeapTupleIsValid(vardata.statsTuple))
+				nullfrac2 += (1.0 - nullfrac2) *
+					((Form_pg_statistic) GETSTRUCT(vardata.statsTuple))->stanullfrac;
+			ReleaseVariableStats(vardata);
+		}
+
+		mvsel = (1.0 - nullfrac1) * (1.0 - nullfrac2) / Max(nd1, nd2);
+		CLAMP_PROBABILITY(mvsel);
+
+		i = -1;
+		while ((i = bms_next_member(group, i)) >= 0)
+			indepsel *= clause_selectivity(root,
+										   (Node *) list_nth(clauses, i),
+										   0, jointype, sjinfo);
+
+		sel *= Max(mvsel, indepsel);
+		*estimatedclauses = bms_add_members(*estimatedclauses, group);
+	}
+
+	return sel;
+}
+
 /*
  * Estimate hash bucket statistics when the specified expression is used
  * as a hash key for the given number of buckets.
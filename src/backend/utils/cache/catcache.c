@@ -83,6 +83,19 @@ static CatCInProgress *catcache_in_progress_stack = NULL;
 /* Cache management header --- pointer is NULL until created */
 static CatCacheHeader *CacheHdr = NULL;
 
+/*
+ * Minimum time, in seconds, that an entry must have gone unused before
+ * CatCacheCleanupOldEntries() may remove it.  -1 disables removal.
+ */
+int			catalog_cache_prune_min_age = -1;
+
+/*
+ * Coarse clock used to stamp entries on access.  It is advanced at the start
+ * of each statement, which is precise enough for our purposes and much
+ * cheaper than reading the time on every cache lookup.
+ */
+static TimestampTz catcacheclock = 0;
+
 static inline HeapTuple SearchCatCacheInternal(CatCache *cache,
 											   int nkeys,
 											   Datum v1, Datum v2,
@@ -109,6 +122,7 @@ static void CatCachePrintStats(int code, Datum arg);
 static void CatCacheRemoveCTup(CatCache *cache, CatCTup *ct);
 static void CatCacheRemoveCList(CatCache *cache, CatCList *cl);
 static void RehashCatCache(CatCache *cp);
+static bool CatCacheCleanupOldEntries(CatCache *cp);
 static void RehashCatCacheLists(CatCache *cp);
 static void CatalogCacheInitializeCache(CatCache *cache);
 static CatCTup *CatalogCacheCreateEntry(CatCache *cache, HeapTuple ntp,
@@ -1016,6 +1030,69 @@ RehashCatCache(CatCache *cp)
 	cp->cc_bucket = newbucket;
 }
 
+/*
+ * SetCatCacheClock
+ *		Advance the clock used to stamp catcache entries on access.
+ *
+ * This is called at the start of each statement.
+ */
+void
+SetCatCacheClock(TimestampTz ts)
+{
+	catcacheclock = ts;
+}
+
+/*
+ * Remove entries that haven't been accessed for catalog_cache_prune_min_age
+ * seconds, to keep caches from growing without bound in sessions that touch
+ * many different catalog objects over time, e.g. in databases with a very
+ * large number of relations.
+ *
+ * Entries that are referenced, or that belong to a CatCList, are kept.
+ *
+ * This is called when the cache is about to be enlarged.  Returns true if
+ * enough entries were removed that enlarging it is unnecessary.  We require
+ * the fill factor to drop noticeably below the enlargement threshold, so that
+ * the cost of scanning the whole cache is amortized over many insertions.
+ */
+static bool
+CatCacheCleanupOldEntries(CatCache *cp)
+{
+	TimestampTz prune_before;
+	int			nremoved = 0;
+
+	if (catalog_cache_prune_min_age < 0 || catcacheclock == 0)
+		return false;
+
+	prune_before = catcacheclock -
+		(TimestampTz) catalog_cache_prune_min_age * USECS_PER_SEC;
+
+	for (int i = 0; i < cp->cc_nbuckets; i++)
+	{
+		dlist_mutable_iter iter;
+
+		dlist_foreach_modify(iter, &cp->cc_bucket[i])
+		{
+			CatCTup    *ct = dlist_container(CatCTup, cache_elem, iter.cur);
+
+			if (ct->refcount > 0 || ct->c_list != NULL)
+				continue;
+
+			if (ct->lastaccess < prune_before)
+			{
+				CatCacheRemoveCTup(cp, ct);
+				nremoved++;
+			}
+		}
+	}
+
+	if (nremoved > 0)
+		elog(DEBUG1, "removed %d unused entries from catalog cache id %d for %s",
+			 nremoved, cp->id, cp->cc_relname);
+
+	return cp->cc_ntup <= cp->cc_nbuckets * 3 / 2;
+}
+
 /*
  * Enlarge a catcache's list storage, doubling the number of buckets.
  */
@@ -1428,6 +1505,7 @@ SearchCatCacheInternal(CatCache *cache,
 		 * near the front of the hashbucket's list.)
 		 */
 		dlist_move_head(bucket, &ct->cache_elem);
+		ct->lastaccess = catcacheclock;
 
 		/*
 		 * If it's a positive entry, bump its refcount and return it. If it's
@@ -2235,6 +2313,7 @@ CatalogCacheCreateEntry(CatCache *cache, HeapTuple ntp, Datum *arguments,
 	ct->refcount = 0;			/* for the moment */
 	ct->dead = false;
 	ct->negative = (ntp == NULL);
+	ct->lastaccess = catcacheclock;
 	ct->hash_value = hashValue;
 
 	dlist_push_head(&cache->cc_bucket[hashIndex], &ct->cache_elem);
@@ -2244,9 +2323,11 @@ CatalogCacheCreateEntry(CatCache *cache, HeapTuple ntp, Datum *arguments,
 
 	/*
 	 * If the hash table has become too full, enlarge the buckets array. Quite
-	 * arbitrarily, we enlarge when fill factor > 2.
+	 * arbitrarily, we enlarge when fill factor > 2.  But first try to make
+	 * room by removing entries that haven't been used for a while.
 	 */
-	if (cache->cc_ntup > cache->cc_nbuckets * 2)
+	if (cache->cc_ntup > cache->cc_nbuckets * 2 &&
+		!CatCacheCleanupOldEntries(cache))
 		RehashCatCache(cache);
 
 	return ct;
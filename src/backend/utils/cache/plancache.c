@@ -240,7 +240,7 @@ CreateCachedPlan(RawStmt *raw_parse_tree,
 	plansource->is_valid = false;
 	plansource->generation = 0;
 	plansource->generic_cost = -1;
-	plansource->total_custom_cost = 0;
+	plansource->avg_custom_cost = 0;
 	plansource->num_generic_plans = 0;
 	plansource->num_custom_plans = 0;
 
@@ -339,7 +339,7 @@ CreateOneShotCachedPlan(RawStmt *raw_parse_tree,
 	plansource->is_valid = false;
 	plansource->generation = 0;
 	plansource->generic_cost = -1;
-	plansource->total_custom_cost = 0;
+	plansource->avg_custom_cost = 0;
 	plansource->num_generic_plans = 0;
 	plansource->num_custom_plans = 0;
 
@@ -917,7 +917,7 @@ RevalidateCachedQuery(CachedPlanSource *plansource,
 	plansource->query_list = qlist;
 
 	/*
-	 * Note: we do not reset generic_cost or total_custom_cost, although we
+	 * Note: we do not reset generic_cost or avg_custom_cost, although we
 	 * could choose to do so.  If the DDL or statistics change that prompted
 	 * the invalidation meant a significant change in the cost estimates, it
 	 * would be better to reset those variables and start fresh; but often it
@@ -1294,8 +1294,6 @@ UpdateCachedPlan(CachedPlanSource *plansource, int query_index,
 static bool
 choose_custom_plan(CachedPlanSource *plansource, ParamListInfo boundParams)
 {
-	double		avg_custom_cost;
-
 	/* One-shot plans will always be considered custom */
 	if (plansource->is_oneshot)
 		return true;
@@ -1323,7 +1321,20 @@ choose_custom_plan(CachedPlanSource *plansource, ParamListInfo boundParams)
 	if (plansource->num_custom_plans < 5)
 		return true;
 
-	avg_custom_cost = plansource->total_custom_cost / plansource->num_custom_plans;
+	/*
+	 * Also generate a custom plan every 1000th (arbitrary) execution, so that
+	 * avg_custom_cost keeps being informed by the parameter values that are
+	 * actually in use.  Otherwise, once the generic plan has won, we'd keep
+	 * using it indefinitely based only on the first five sets of parameter
+	 * values, even if those turn out to have been unrepresentative.  Since
+	 * avg_custom_cost favors recent custom plans, a few such samples suffice
+	 * to switch back to custom plans if they've become cheaper.  Since each
+	 * call increments one of the counters, this can't repeat on consecutive
+	 * calls.
+	 */
+	if ((plansource->num_generic_plans + plansource->num_custom_plans) %
+		1000 == 0)
+		return true;
 
 	/*
 	 * Prefer generic plan if it's less expensive than the average custom
@@ -1335,7 +1346,7 @@ choose_custom_plan(CachedPlanSource *plansource, ParamListInfo boundParams)
 	 * Note that if generic_cost is -1 (indicating we've not yet determined
 	 * the generic plan cost), we'll always prefer generic at this point.
 	 */
-	if (plansource->generic_cost < avg_custom_cost)
+	if (plansource->generic_cost < plansource->avg_custom_cost)
 		return false;
 
 	return true;
@@ -1498,8 +1509,15 @@ GetCachedPlan(CachedPlanSource *plansource, ParamListInfo boundParams,
 	{
 		/* Build a custom plan */
 		plan = BuildCachedPlan(plansource, qlist, boundParams, queryEnv);
-		/* Accumulate total costs of custom plans */
-		plansource->total_custom_cost += cached_plan_cost(plan, true);
+
+		/*
+		 * Update the average cost of custom plans.  The first five are
+		 * weighted equally; after that, each new plan counts for a fifth of
+		 * the average, so that older costs decay away.
+		 */
+		plansource->avg_custom_cost +=
+			(cached_plan_cost(plan, true) - plansource->avg_custom_cost) /
+			Min(plansource->num_custom_plans + 1, 5);
 
 		plansource->num_custom_plans++;
 	}
@@ -1865,7 +1883,7 @@ CopyCachedPlan(CachedPlanSource *plansource)
 
 	/* We may as well copy any acquired cost knowledge */
 	newsource->generic_cost = plansource->generic_cost;
-	newsource->total_custom_cost = plansource->total_custom_cost;
+	newsource->avg_custom_cost = plansource->avg_custom_cost;
 	newsource->num_generic_plans = plansource->num_generic_plans;
 	newsource->num_custom_plans = plansource->num_custom_plans;
 
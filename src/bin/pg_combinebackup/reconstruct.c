@@ -22,6 +22,12 @@
 #include "reconstruct.h"
 #include "storage/block.h"
 
+/*
+ * Maximum number of blocks that write_reconstructed_file() reads, writes or
+ * copies at once.
+ */
+#define MAX_BLOCKS_PER_COPY		128
+
 /*
  * An rfile stores the data that we need in order to be able to use some file
  * on disk for reconstruction. For any given output file, we create one rfile
@@ -62,10 +68,10 @@ static void write_reconstructed_file(char *input_filename,
 									 bool debug,
 									 bool dry_run);
 static void read_bytes(rfile *rf, void *buffer, unsigned length);
-static void write_block(int fd, char *output_filename,
-						uint8 *buffer,
-						pg_checksum_context *checksum_ctx);
-static void read_block(rfile *s, off_t off, uint8 *buffer);
+static void write_blocks(int fd, char *output_filename,
+						 uint8 *buffer, unsigned nblocks,
+						 pg_checksum_context *checksum_ctx);
+static void read_blocks(rfile *s, off_t off, uint8 *buffer, unsigned nblocks);
 
 /*
  * Reconstruct a full file from an incremental file and a chain of prior
@@ -561,6 +567,7 @@ write_reconstructed_file(char *input_filename,
 	int			wfd = -1;
 	unsigned	i;
 	unsigned	zero_blocks = 0;
+	uint8	   *buffer = NULL;
 
 	/* Debugging output. */
 	if (debug)
@@ -638,50 +645,66 @@ write_reconstructed_file(char *input_filename,
 		pg_fatal("could not open file \"%s\": %m", output_filename);
 
 	/* Read and write the blocks as required. */
-	for (i = 0; i < block_length; ++i)
+	if (!dry_run)
+		buffer = pg_malloc(MAX_BLOCKS_PER_COPY * BLCKSZ);
+	i = 0;
+	while (i < block_length)
 	{
-		uint8		buffer[BLCKSZ];
 		rfile	   *s = sourcemap[i];
+		unsigned	nblocks = 1;
+		size_t		nbytes;
+
+		/*
+		 * Process runs of blocks that are zero-filled, or that come from
+		 * consecutive offsets of the same source file, as a unit. This saves
+		 * system calls, and lets copy_file_range share extents between files
+		 * on filesystems that support that.
+		 */
+		while (nblocks < MAX_BLOCKS_PER_COPY &&
+			   i + nblocks < block_length &&
+			   sourcemap[i + nblocks] == s &&
+			   (s == NULL ||
+				offsetmap[i + nblocks] == offsetmap[i] + (off_t) nblocks * BLCKSZ))
+			nblocks++;
+		nbytes = (size_t) nblocks * BLCKSZ;
 
 		/* Update accounting information. */
 		if (s == NULL)
-			++zero_blocks;
+			zero_blocks += nblocks;
 		else
 		{
-			s->num_blocks_read++;
+			s->num_blocks_read += nblocks;
 			s->highest_offset_read = Max(s->highest_offset_read,
-										 offsetmap[i] + BLCKSZ);
+										 offsetmap[i] + (off_t) nbytes);
 		}
 
 		/* Skip the rest of this in dry-run mode. */
 		if (dry_run)
+		{
+			i += nblocks;
 			continue;
+		}
 
-		/* Read or zero-fill the block as appropriate. */
+		/* Read or zero-fill the blocks as appropriate. */
 		if (s == NULL)
 		{
 			/*
-			 * New block not mentioned in the WAL summary. Should have been an
-			 * uninitialized block, so just zero-fill it.
+			 * New blocks not mentioned in the WAL summary. Should have been
+			 * uninitialized blocks, so just zero-fill them.
 			 */
-			memset(buffer, 0, BLCKSZ);
-
-			/* Write out the block, update the checksum if needed. */
-			write_block(wfd, output_filename, buffer, checksum_ctx);
+			memset(buffer, 0, nbytes);
 
-			/* Nothing else to do for zero-filled blocks. */
-			continue;
+			/* Write out the blocks, update the checksum if needed. */
+			write_blocks(wfd, output_filename, buffer, nblocks, checksum_ctx);
 		}
-
-		/* Copy the block using the appropriate copy method. */
-		if (copy_method != COPY_METHOD_COPY_FILE_RANGE)
+		else if (copy_method != COPY_METHOD_COPY_FILE_RANGE)
 		{
 			/*
-			 * Read the block from the correct source file, and then write it
-			 * out, possibly with a checksum update.
+			 * Read the blocks from the correct source file, and then write
+			 * them out, possibly with a checksum update.
 			 */
-			read_block(s, offsetmap[i], buffer);
-			write_block(wfd, output_filename, buffer, checksum_ctx);
+			read_blocks(s, offsetmap[i], buffer, nblocks);
+			write_blocks(wfd, output_filename, buffer, nblocks, checksum_ctx);
 		}
 		else					/* use copy_file_range */
 		{
@@ -696,9 +719,9 @@ write_reconstructed_file(char *input_filename,
 			 */
 			do
 			{
-				int			wb;
+				ssize_t		wb;
 
-				wb = copy_file_range(s->fd, &off, wfd, NULL, BLCKSZ - nwritten, 0);
+				wb = copy_file_range(s->fd, &off, wfd, NULL, nbytes - nwritten, 0);
 
 				if (wb < 0)
 					pg_fatal("error while copying file range from \"%s\" to \"%s\": %m",
@@ -706,26 +729,31 @@ write_reconstructed_file(char *input_filename,
 
 				nwritten += wb;
 
-			} while (BLCKSZ > nwritten);
+			} while (nbytes > nwritten);
 
 			/*
 			 * When checksum calculation not needed, we're done, otherwise
-			 * read the block and pass it to the checksum calculation.
+			 * read the blocks and pass them to the checksum calculation.
 			 */
-			if (checksum_ctx->type == CHECKSUM_TYPE_NONE)
-				continue;
-
-			read_block(s, offsetmap[i], buffer);
+			if (checksum_ctx->type != CHECKSUM_TYPE_NONE)
+			{
+				read_blocks(s, offsetmap[i], buffer, nblocks);
 
-			if (pg_checksum_update(checksum_ctx, buffer, BLCKSZ) < 0)
-				pg_fatal("could not update checksum of file \"%s\"",
-						 output_filename);
+				if (pg_checksum_update(checksum_ctx, buffer, nbytes) < 0)
+					pg_fatal("could not update checksum of file \"%s\"",
+							 output_filename);
+			}
 #else
 			pg_fatal("copy_file_range not supported on this platform");
 #endif
 		}
+
+		i += nblocks;
 	}
 
+	if (buffer != NULL)
+		pfree(buffer);
+
 	/* Debugging output. */
 	if (zero_blocks > 0)
 	{
@@ -741,49 +769,52 @@ write_reconstructed_file(char *input_filename,
 }
 
 /*
- * Write the block into the file (using the file descriptor), and
+ * Write the blocks into the file (using the file descriptor), and
  * if needed update the checksum calculation.
  *
- * The buffer is expected to contain BLCKSZ bytes. The filename is
+ * The buffer is expected to contain nblocks * BLCKSZ bytes. The filename is
  * provided only for the error message.
  */
 static void
-write_block(int fd, char *output_filename,
-			uint8 *buffer, pg_checksum_context *checksum_ctx)
+write_blocks(int fd, char *output_filename,
+			 uint8 *buffer, unsigned nblocks,
+			 pg_checksum_context *checksum_ctx)
 {
+	int			nbytes = nblocks * BLCKSZ;
 	int			wb;
 
-	if ((wb = write(fd, buffer, BLCKSZ)) != BLCKSZ)
+	if ((wb = write(fd, buffer, nbytes)) != nbytes)
 	{
 		if (wb < 0)
 			pg_fatal("could not write file \"%s\": %m", output_filename);
 		else
 			pg_fatal("could not write file \"%s\": wrote %d of %d",
-					 output_filename, wb, BLCKSZ);
+					 output_filename, wb, nbytes);
 	}
 
 	/* Update the checksum computation. */
-	if (pg_checksum_update(checksum_ctx, buffer, BLCKSZ) < 0)
+	if (pg_checksum_update(checksum_ctx, buffer, nbytes) < 0)
 		pg_fatal("could not update checksum of file \"%s\"",
 				 output_filename);
 }
 
 /*
- * Read a block of data (BLCKSZ bytes) into the buffer.
+ * Read nblocks blocks of data (nblocks * BLCKSZ bytes) into the buffer.
  */
 static void
-read_block(rfile *s, off_t off, uint8 *buffer)
+read_blocks(rfile *s, off_t off, uint8 *buffer, unsigned nblocks)
 {
+	int			nbytes = nblocks * BLCKSZ;
 	int			rb;
 
-	/* Read the block from the correct source, except if dry-run. */
-	rb = pg_pread(s->fd, buffer, BLCKSZ, off);
-	if (rb != BLCKSZ)
+	/* Read the blocks from the correct source. */
+	rb = pg_pread(s->fd, buffer, nbytes, off);
+	if (rb != nbytes)
 	{
 		if (rb < 0)
 			pg_fatal("could not read from file \"%s\": %m", s->filename);
 		else
 			pg_fatal("could not read from file \"%s\", offset %llu: read %d of %d",
-					 s->filename, (unsigned long long) off, rb, BLCKSZ);
+					 s->filename, (unsigned long long) off, rb, nbytes);
 	}
 }
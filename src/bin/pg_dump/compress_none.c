@@ -22,6 +22,19 @@
  *----------------------
  */
 
+/*
+ * Data is written out in blocks of up to this size.  Callers such as
+ * dumpTableData_copy() pass one row at a time, and we don't want to write a
+ * separate length-prefixed block into the archive for each row.
+ */
+#define NONE_WRITE_BUFFER_SIZE	(64 * 1024)
+
+typedef struct NoneCompressorState
+{
+	char	   *buf;
+	size_t		buflen;			/* bytes currently in buf */
+} NoneCompressorState;
+
 /*
  * Private routines
  */
@@ -49,13 +62,40 @@ static void
 WriteDataToArchiveNone(ArchiveHandle *AH, CompressorState *cs,
 					   const void *data, size_t dLen)
 {
-	cs->writeF(AH, data, dLen);
+	NoneCompressorState *nonecs = (NoneCompressorState *) cs->private_data;
+
+	/* Flush the buffer first if the new data doesn't fit into it. */
+	if (nonecs->buflen > 0 && nonecs->buflen + dLen > NONE_WRITE_BUFFER_SIZE)
+	{
+		cs->writeF(AH, nonecs->buf, nonecs->buflen);
+		nonecs->buflen = 0;
+	}
+
+	/* Data that is too big to buffer is written out directly. */
+	if (dLen >= NONE_WRITE_BUFFER_SIZE)
+		cs->writeF(AH, data, dLen);
+	else
+	{
+		memcpy(nonecs->buf + nonecs->buflen, data, dLen);
+		nonecs->buflen += dLen;
+	}
 }
 
 static void
 EndCompressorNone(ArchiveHandle *AH, CompressorState *cs)
 {
-	/* no op */
+	NoneCompressorState *nonecs = (NoneCompressorState *) cs->private_data;
+
+	/* Nothing needs to be done if we were only reading. */
+	if (nonecs == NULL)
+		return;
+
+	if (nonecs->buflen > 0)
+		cs->writeF(AH, nonecs->buf, nonecs->buflen);
+
+	pg_free(nonecs->buf);
+	pg_free(nonecs);
+	cs->private_data = NULL;
 }
 
 /*
@@ -71,6 +111,17 @@ InitCompressorNone(CompressorState *cs,
 	cs->end = EndCompressorNone;
 
 	cs->compression_spec = compression_spec;
+
+	/* Set up a write buffer, if we are going to write. */
+	if (cs->writeF)
+	{
+		NoneCompressorState *nonecs;
+
+		nonecs = (NoneCompressorState *) pg_malloc(sizeof(NoneCompressorState));
+		nonecs->buf = pg_malloc(NONE_WRITE_BUFFER_SIZE);
+		nonecs->buflen = 0;
+		cs->private_data = nonecs;
+	}
 }
 
 
@@ -0,0 +1,107 @@
+# Copyright (c) 2021-2025, PostgreSQL Global Development Group
+
+# Check that blocks modified after a relation has been truncated and then
+# extended again are recorded in the WAL summary.
+
+use strict;
+use warnings FATAL => 'all';
+use PostgreSQL::Test::Cluster;
+use PostgreSQL::Test::Utils;
+use Test::More;
+
+# Set up a new database instance.
+my $node1 = PostgreSQL::Test::Cluster->new('node1');
+$node1->init(has_archiving => 1, allows_streaming => 1);
+$node1->append_conf('postgresql.conf', 'summarize_wal = on');
+$node1->append_conf('postgresql.conf', 'autovacuum = off');
+$node1->start;
+
+# Create a table spanning a few blocks, and make sure the WAL summarizer has
+# caught up with its creation.
+$node1->safe_psql('postgres', <<EOM);
+CREATE TABLE mytable (a int, b text);
+INSERT INTO mytable
+SELECT
+	g, repeat('x', 500)
+FROM
+	generate_series(1, 100) g;
+VACUUM FREEZE mytable;
+CHECKPOINT;
+EOM
+my $base_lsn = $node1->safe_psql('postgres',
+	'SELECT pg_current_wal_insert_lsn()');
+my $result = $node1->poll_query_until('postgres', <<EOM);
+SELECT EXISTS (
+    SELECT * from pg_available_wal_summaries()
+    WHERE end_lsn >= '$base_lsn'
+)
+EOM
+ok($result, "WAL summarization caught up after insert");
+
+my $summarized_lsn = $node1->safe_psql('postgres', <<EOM);
+SELECT MAX(end_lsn) AS summarized_lsn FROM pg_available_wal_summaries()
+EOM
+note("after insert, summarized through $summarized_lsn");
+
+# Modify every block, truncate the relation away entirely with VACUUM, and
+# then extend it again.  The summarizer sees modifications to blocks that
+# are then removed by the truncation, followed by modifications to the same
+# block numbers after the truncation.
+$node1->safe_psql('postgres', <<EOM);
+DELETE FROM mytable;
+VACUUM mytable;
+EOM
+my $size = $node1->safe_psql('postgres',
+	"SELECT pg_relation_size('mytable')");
+is($size, '0', "VACUUM truncated the table");
+
+$node1->safe_psql('postgres', <<EOM);
+INSERT INTO mytable
+SELECT
+	g, repeat('y', 500)
+FROM
+	generate_series(1, 40) g;
+EOM
+my $nblocks = $node1->safe_psql('postgres',
+	"SELECT pg_relation_size('mytable') / current_setting('block_size')::int");
+note("table re-extended to $nblocks blocks");
+cmp_ok($nblocks, '>', 1, "table was extended to several blocks");
+
+$node1->safe_psql('postgres', 'CHECKPOINT');
+my $end_lsn = $node1->safe_psql('postgres',
+	'SELECT pg_current_wal_insert_lsn()');
+$result = $node1->poll_query_until('postgres', <<EOM);
+SELECT EXISTS (
+    SELECT * from pg_available_wal_summaries()
+    WHERE end_lsn >= '$end_lsn'
+)
+EOM
+ok($result, "WAL summarization caught up after truncation");
+
+# Every block of the re-extended table must be reported as modified.
+my $modified = $node1->safe_psql('postgres', <<EOM);
+SELECT count(DISTINCT c.relblocknumber)
+FROM pg_available_wal_summaries() s,
+	LATERAL pg_wal_summary_contents(s.tli, s.start_lsn, s.end_lsn) c
+WHERE s.end_lsn > '$summarized_lsn'
+	AND c.relfilenode = pg_relation_filenode('mytable')
+	AND c.relforknumber = 0
+	AND NOT c.is_limit_block
+	AND c.relblocknumber < $nblocks
+EOM
+is($modified, $nblocks,
+	"all blocks of the re-extended table are summarized as modified");
+
+# And the truncation must be recorded as a limit block of 0.
+my $limit = $node1->safe_psql('postgres', <<EOM);
+SELECT min(c.relblocknumber)
+FROM pg_available_wal_summaries() s,
+	LATERAL pg_wal_summary_contents(s.tli, s.start_lsn, s.end_lsn) c
+WHERE s.end_lsn > '$summarized_lsn'
+	AND c.relfilenode = pg_relation_filenode('mytable')
+	AND c.relforknumber = 0
+	AND c.is_limit_block
+EOM
+is($limit, '0', "truncation is summarized as limit block 0");
+
+done_testing();
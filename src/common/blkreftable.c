@@ -144,6 +144,7 @@ struct BlockRefTableEntry
 struct BlockRefTable
 {
 	blockreftable_hash *hash;
+	BlockRefTableEntry *last_entry; /* most recently used entry, or NULL */
 #ifndef FRONTEND
 	MemoryContext mcxt;
 #endif
@@ -236,6 +237,8 @@ CreateEmptyBlockRefTable(void)
 {
 	BlockRefTable *brtab = palloc(sizeof(BlockRefTable));
 
+	brtab->last_entry = NULL;
+
 	/*
 	 * Even completely empty database has a few hundred relation forks, so it
 	 * seems best to size the hash on the assumption that we're going to have
@@ -272,6 +275,12 @@ BlockRefTableSetLimitBlock(BlockRefTable *brtab,
 	key.forknum = forknum;
 	brtentry = blockreftable_insert(brtab->hash, key, &found);
 
+	/*
+	 * Inserting a new entry may have moved existing entries around, so the
+	 * entry cached by BlockRefTableMarkBlockModified() must be replaced.
+	 */
+	brtab->last_entry = brtentry;
+
 	if (!found)
 	{
 		/*
@@ -308,7 +317,24 @@ BlockRefTableMarkBlockModified(BlockRefTable *brtab,
 
 	memcpy(&key.rlocator, rlocator, sizeof(RelFileLocator));
 	key.forknum = forknum;
+
+	/*
+	 * Consecutive WAL records very often touch the same relation fork, so
+	 * check the entry we used last time before doing a hash lookup.
+	 */
+	if (brtab->last_entry != NULL &&
+		memcmp(&brtab->last_entry->key, &key, sizeof(BlockRefTableKey)) == 0)
+	{
+		BlockRefTableEntryMarkBlockModified(brtab->last_entry, forknum,
+											blknum);
+#ifndef FRONTEND
+		MemoryContextSwitchTo(oldcontext);
+#endif
+		return;
+	}
+
 	brtentry = blockreftable_insert(brtab->hash, key, &found);
+	brtab->last_entry = brtentry;
 
 	if (!found)
 	{
@@ -1052,8 +1078,15 @@ BlockRefTableEntryMarkBlockModified(BlockRefTableEntry *entry,
 	/*
 	 * There is an existing chunk and it's in array format. Let's find out
 	 * whether it already has an entry for this block. If so, we do not need
-	 * to do anything.
+	 * to do anything.  The same block is often modified by several records
+	 * in a row, so check the most recently added entry first.  Note that the
+	 * array can be empty here, if BlockRefTableEntrySetLimitBlock() removed
+	 * all of its entries.
 	 */
+	if (entry->chunk_usage[chunkno] > 0 &&
+		entry->chunk_data[chunkno][entry->chunk_usage[chunkno] - 1] ==
+		chunkoffset)
+		return;
 	for (i = 0; i < entry->chunk_usage[chunkno]; ++i)
 	{
 		if (entry->chunk_data[chunkno][i] == chunkoffset)
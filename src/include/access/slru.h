@@ -156,6 +156,15 @@ typedef struct SlruCtlData
 	 */
 	bool		(*PagePrecedes) (int64, int64);
 
+	/*
+	 * Backend-local state used to detect sequential reads, so that we can ask
+	 * the kernel to read ahead.  last_read_pageno is the page most recently
+	 * read from disk by this backend, and readahead_pageno the last page that
+	 * read-ahead has been requested for, or -1 if none.
+	 */
+	int64		last_read_pageno;
+	int64		readahead_pageno;
+
 	/*
 	 * Dir is set during SimpleLruInit and does not change thereafter. Since
 	 * it's always the same, it doesn't need to be in shared memory.
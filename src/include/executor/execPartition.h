@@ -41,6 +41,8 @@ extern void ExecCleanupTupleRouting(ModifyTableState *mtstate,
  * subplan_map[] and subpart_map[] have the same definitions as in
  * PartitionedRelPruneInfo (see plannodes.h); though note that here,
  * subpart_map contains indexes into PartitionPruningData.partrelprunedata[].
+ * Unless exec pruning is to be done, subplan_map[] and present_parts may
+ * point to the PartitionedRelPruneInfo's own copies, so must not be modified.
  *
  * partrel						Partitioned table Relation; obtained by
  * 								ExecGetRangeTableRelation(estate, rti, false),
@@ -2309,6 +2309,9 @@ typedef struct MemoizeInstrumentation
 									 * cache when filling it due to not being
 									 * able to free enough space to store the
 									 * current scan's tuples. */
+	uint64		cache_bypasses; /* number of lookups performed without the
+								 * cache after caching was disabled due to a
+								 * poor hit ratio */
 	uint64		mem_peak;		/* peak memory usage in bytes */
 } MemoizeInstrumentation;
 
@@ -2357,6 +2360,13 @@ typedef struct MemoizeState
 								 * complete after caching the first tuple. */
 	bool		binary_mode;	/* true when cache key should be compared bit
 								 * by bit, false when using hash equality ops */
+	bool		cache_disabled; /* true if we've stopped caching due to a
+								 * poor cache hit ratio */
+	uint64		window_lookups; /* cache lookups since caching was last
+								 * (re)enabled */
+	uint64		window_hits;	/* cache hits among window_lookups */
+	uint64		window_evictions;	/* entries evicted to free memory since
+									 * caching was last (re)enabled */
 	MemoizeInstrumentation stats;	/* execution statistics */
 	SharedMemoizeInfo *shared_info; /* statistics for parallel workers */
 	Bitmapset  *keyparamids;	/* Param->paramids of expressions belonging to
@@ -733,7 +733,8 @@ typedef struct PartitionSchemeData *PartitionScheme;
  *		tuples - number of tuples in relation (not considering restrictions)
  *		allvisfrac - fraction of disk pages that are marked all-visible
  *		eclass_indexes - EquivalenceClasses that mention this rel (filled
- *						 only after EC merging is complete)
+ *						 only after EC merging is complete; join rels also
+ *						 set this, to the union of their inputs' sets)
  *		subroot - PlannerInfo for subquery (NULL if it's not a subquery)
  *		subplan_params - list of PlannerParamItems to be passed to subquery
  *
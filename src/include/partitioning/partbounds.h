@@ -16,6 +16,7 @@
 #include "partitioning/partdefs.h"
 
 struct RelOptInfo;				/* avoid including pathnodes.h here */
+struct SortSupportData;			/* avoid including sortsupport.h here */
 
 
 /*
@@ -142,5 +143,15 @@ extern int	partition_range_datum_bsearch(FmgrInfo *partsupfunc,
 										  int nvalues, Datum *values, bool *is_equal);
 extern int	partition_hash_bsearch(PartitionBoundInfo boundinfo,
 								   int modulus, int remainder);
+extern int32 partition_rbound_datum_cmp_ssup(struct SortSupportData *ssup,
+											 Datum *rb_datums, PartitionRangeDatumKind *rb_kind,
+											 Datum *tuple_datums, int n_tuple_datums);
+extern int	partition_list_bsearch_ssup(struct SortSupportData *ssup,
+										PartitionBoundInfo boundinfo,
+										Datum value, bool *is_equal);
+extern int	partition_range_datum_bsearch_ssup(struct SortSupportData *ssup,
+											   PartitionBoundInfo boundinfo,
+											   int nvalues, Datum *values,
+											   bool *is_equal);
 
 #endif							/* PARTBOUNDS_H */
@@ -655,6 +655,10 @@ struct ReorderBuffer
 	char	   *outbuf;
 	Size		outbufsize;
 
+	/* buffer used to batch writes of serialized changes to spill files */
+	char	   *spillbuf;
+	Size		spillbuflen;
+
 	/* memory accounting */
 	Size		size;
 
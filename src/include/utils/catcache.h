@@ -22,6 +22,7 @@
 
 #include "access/htup.h"
 #include "access/skey.h"
+#include "datatype/timestamp.h"
 #include "lib/ilist.h"
 #include "utils/relcache.h"
 
@@ -131,6 +132,13 @@ typedef struct catctup
 	 */
 	struct catclist *c_list;	/* containing CatCList, or NULL if none */
 
+	/*
+	 * Approximate time of the last access to this entry, used to find
+	 * entries that haven't been used for a while and can be removed.  See
+	 * CatCacheCleanupOldEntries().
+	 */
+	TimestampTz lastaccess;
+
 	CatCache   *my_cache;		/* link to owning catcache */
 	/* properly aligned tuple data follows, unless a negative entry */
 } CatCTup;
@@ -191,6 +199,11 @@ typedef struct catcacheheader
 /* this extern duplicates utils/memutils.h... */
 extern PGDLLIMPORT MemoryContext CacheMemoryContext;
 
+/* GUC variable */
+extern PGDLLIMPORT int catalog_cache_prune_min_age;
+
+extern void SetCatCacheClock(TimestampTz ts);
+
 extern void CreateCacheMemoryContext(void);
 
 extern CatCache *InitCatCache(int id, Oid reloid, Oid indexoid,
@@ -143,8 +143,8 @@ typedef struct CachedPlanSource
 	dlist_node	node;			/* list link, if is_saved */
 	/* State kept to help decide whether to use custom or generic plans: */
 	double		generic_cost;	/* cost of generic plan, or -1 if not known */
-	double		total_custom_cost;	/* total cost of custom plans so far */
-	int64		num_custom_plans;	/* # of custom plans included in total */
+	double		avg_custom_cost;	/* decaying average cost of custom plans */
+	int64		num_custom_plans;	/* # of custom plans */
 	int64		num_generic_plans;	/* # of generic plans */
 } CachedPlanSource;
 
@@ -222,6 +222,11 @@ extern List *estimate_multivariate_bucketsize(PlannerInfo *root,
 											  RelOptInfo *inner,
 											  List *hashclauses,
 											  Selectivity *innerbucketsize);
+extern Selectivity estimate_multivariate_eqjoinsel(PlannerInfo *root,
+												   List *clauses,
+												   JoinType jointype,
+												   SpecialJoinInfo *sjinfo,
+												   Bitmapset **estimatedclauses);
 extern void estimate_hash_bucket_stats(PlannerInfo *root,
 									   Node *hashkey, double nbuckets,
 									   Selectivity *mcv_freq,
@@ -0,0 +1,57 @@
+
+# Copyright (c) 2025, PostgreSQL Global Development Group
+
+# Test removal of unused catalog cache entries, controlled by
+# catalog_cache_prune_min_age.
+
+use strict;
+use warnings FATAL => 'all';
+
+use PostgreSQL::Test::Cluster;
+use PostgreSQL::Test::Utils;
+use Test::More;
+
+my $node = PostgreSQL::Test::Cluster->new('node');
+$node->init();
+$node->start;
+
+$node->safe_psql('postgres', 'CREATE TABLE catcache_prune_tab (a int);');
+
+my $session = $node->background_psql('postgres');
+$session->query_safe('SET log_min_messages = debug1;');
+
+# Each lookup of a nonexistent relation name leaves a negative entry in the
+# pg_class name cache, so these fill that cache well past the point where it
+# has to be enlarged.
+my $log_offset = -s $node->logfile;
+$session->query_safe(
+	q[SELECT count(to_regclass('catcache_prune_a_' || g))
+	  FROM generate_series(1, 2000) g;]);
+ok( !$node->log_contains(
+		qr/removed \d+ unused entries from catalog cache/, $log_offset),
+	'no catalog cache entries removed by default');
+
+# With a minimum age of zero, entries from the previous statement are old
+# enough to be removed when the cache next fills up.
+$session->query_safe('SET catalog_cache_prune_min_age = 0;');
+$log_offset = -s $node->logfile;
+$session->query_safe(
+	q[SELECT count(to_regclass('catcache_prune_b_' || g))
+	  FROM generate_series(1, 5000) g;]);
+ok( $node->log_contains(
+		qr/removed \d+ unused entries from catalog cache id \d+ for pg_class/,
+		$log_offset),
+	'unused catalog cache entries removed');
+
+# Lookups still give the right answers, whether or not the entries they need
+# were removed.
+is( $session->query_safe(
+		q[SELECT to_regclass('catcache_prune_a_1') IS NULL,
+		         to_regclass('catcache_prune_b_1') IS NULL,
+		         to_regclass('catcache_prune_tab')::text;]),
+	't|t|catcache_prune_tab',
+	'catalog lookups work after removal');
+
+$session->quit;
+
+done_testing();
@@ -132,6 +132,37 @@ SELECT COUNT(*),AVG(t1.unique1) FROM tenk1 t1
 INNER JOIN tenk1 t2 ON t1.unique1 = t2.thousand
 WHERE t2.unique1 < 1200;', true);
 
+-- Ensure Memoize gives up on caching when the cache is thrashing.  Lie to the
+-- planner about the number of distinct keys so that we get a Memoize node,
+-- then feed it keys in an order that causes every lookup to miss.
+CREATE TABLE memo_bypass (k int);
+INSERT INTO memo_bypass SELECT i % 10000 FROM generate_series(0, 19999) i;
+ALTER TABLE memo_bypass ALTER COLUMN k SET (n_distinct = 10);
+ANALYZE memo_bypass;
+SELECT explain_memoize('
+SELECT COUNT(*),AVG(t1.unique1) FROM memo_bypass mb
+INNER JOIN tenk1 t1 ON t1.unique1 = mb.k;', false);
+DROP TABLE memo_bypass;
+
+-- Ensure caching is given another chance when a parameter that's not part of
+-- the cache key changes.  The first group's keys make Memoize give up on
+-- caching, but the second group's keys repeat, so we should see cache hits.
+CREATE TABLE memo_reenable (g int, k int);
+INSERT INTO memo_reenable SELECT 1, i % 10000 FROM generate_series(0, 19999) i;
+INSERT INTO memo_reenable SELECT 2, i % 10 FROM generate_series(0, 4999) i;
+ALTER TABLE memo_reenable ALTER COLUMN k SET (n_distinct = 10);
+ANALYZE memo_reenable;
+CREATE TABLE memo_groups (g int);
+INSERT INTO memo_groups VALUES (1), (2);
+ANALYZE memo_groups;
+SELECT explain_memoize('
+SELECT grp.g, (SELECT COUNT(*) FROM memo_reenable mr
+               INNER JOIN tenk1 t1 ON t1.unique1 = mr.k
+               WHERE mr.g = grp.g AND t1.hundred <= grp.g + 99)
+FROM memo_groups grp;', false);
+DROP TABLE memo_reenable;
+DROP TABLE memo_groups;
+
 CREATE TABLE flt (f float);
 CREATE INDEX flt_f_idx ON flt (f);
 INSERT INTO flt VALUES('-0.0'::float),('+0.0'::float);
@@ -222,4 +222,26 @@ explain (costs off) execute test_mode_pp(2);
 select name, generic_plans, custom_plans from pg_prepared_statements
   where  name = 'test_mode_pp';
 
+-- a custom plan is still made every 1000th execution once the generic plan
+-- has won, so that the average custom-plan cost stays current
+set plan_cache_mode to auto;
+prepare test_replan_pp (int) as select count(*) from test_mode where a = $1;
+do $$
+begin
+  for i in 1..1000 loop
+    execute 'execute test_replan_pp(1)';
+  end loop;
+end
+$$;
+select name, generic_plans, custom_plans from pg_prepared_statements
+  where  name = 'test_replan_pp';
+execute test_replan_pp(1);
+select name, generic_plans, custom_plans from pg_prepared_statements
+  where  name = 'test_replan_pp';
+-- and the generic plan is used again afterwards
+execute test_replan_pp(1);
+select name, generic_plans, custom_plans from pg_prepared_statements
+  where  name = 'test_replan_pp';
+deallocate test_replan_pp;
+
 drop table test_mode;
@@ -1748,3 +1748,23 @@ EXPLAIN (COSTS OFF) -- Choose hash join
 SELECT * FROM sb_1 a, sb_2 b WHERE a.x = b.x AND a.y = b.y AND a.z = b.z;
 
 DROP TABLE sb_1, sb_2 CASCADE;
+
+--
+-- Extended statistics on the join columns of both relations improve the
+-- estimate of a join on correlated columns.
+--
+CREATE TABLE sj_1 (x int, y int) WITH (autovacuum_enabled = off);
+CREATE TABLE sj_2 (x int, y int) WITH (autovacuum_enabled = off);
+INSERT INTO sj_1 SELECT i % 10, i % 10 FROM generate_series(1, 1000) s(i);
+INSERT INTO sj_2 SELECT i % 10, i % 10 FROM generate_series(1, 1000) s(i);
+ANALYZE sj_1, sj_2;
+
+SELECT * FROM check_estimated_rows('SELECT * FROM sj_1 a JOIN sj_2 b ON a.x = b.x AND a.y = b.y');
+
+CREATE STATISTICS sj_1_stats (ndistinct) ON x, y FROM sj_1;
+CREATE STATISTICS sj_2_stats (ndistinct) ON x, y FROM sj_2;
+ANALYZE sj_1, sj_2;
+
+SELECT * FROM check_estimated_rows('SELECT * FROM sj_1 a JOIN sj_2 b ON a.x = b.x AND a.y = b.y');
+
+DROP TABLE sj_1, sj_2;